@@ -0,0 +1,79 @@
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <new>
+#include <string>
+#include <vector>
+
+#include "blet/args.h"
+
+static std::size_t s_allocationCount = 0;
+
+void* operator new(std::size_t size) {
+    ++s_allocationCount;
+    void* ptr = std::malloc(size == 0 ? 1 : size);
+    if (ptr == NULL) {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+void operator delete(void* ptr) throw() {
+    std::free(ptr);
+}
+
+#if __cplusplus >= 201402L
+void operator delete(void* ptr, std::size_t) throw() {
+    std::free(ptr);
+}
+#endif
+
+int main(int argc, char* argv[]) {
+    std::size_t count = (argc > 1) ? std::strtoul(argv[1], NULL, 10) : 10000;
+    std::size_t loop = (argc > 2) ? std::strtoul(argv[2], NULL, 10) : 10;
+
+    // --option-0 --option-1 ...
+    std::vector<std::string> flags;
+    for (std::size_t i = 0; i < count; ++i) {
+        char buffer[32];
+        std::sprintf(buffer, "--option-%lu", static_cast<unsigned long>(i));
+        flags.push_back(buffer);
+    }
+    const char* parseArgv[] = {"binaryName", "--option-0"};
+
+    std::size_t allocationCount = s_allocationCount;
+    std::size_t memoryUsage = 0;
+    std::clock_t start = std::clock();
+    for (std::size_t i = 0; i < loop; ++i) {
+        blet::Args args;
+        for (std::size_t j = 0; j < count; ++j) {
+            args.addArgument(flags[j]).action(args.STORE_TRUE);
+        }
+        args.parseArguments(sizeof(parseArgv) / sizeof(*parseArgv), const_cast<char**>(parseArgv));
+        memoryUsage = args.memoryUsage();
+    }
+    std::clock_t end = std::clock();
+    allocationCount = s_allocationCount - allocationCount;
+
+    std::printf("addArgument x%lu: %.3f ms/args, %lu allocations/args, %lu bytes/args\n",
+                static_cast<unsigned long>(count), (end - start) * 1000.0 / CLOCKS_PER_SEC / loop,
+                static_cast<unsigned long>(allocationCount / loop), static_cast<unsigned long>(memoryUsage));
+
+    // completion of "--option-12" with the sorted flags built at the first call
+    blet::Args args;
+    for (std::size_t j = 0; j < count; ++j) {
+        args.addArgument(flags[j]).action(args.STORE_TRUE);
+    }
+    const char* completeArgv[] = {"binaryName", "--option-0", "--option-12"};
+    const int completeArgc = sizeof(completeArgv) / sizeof(*completeArgv);
+    std::size_t candidateCount = 0;
+    start = std::clock();
+    for (std::size_t i = 0; i < loop; ++i) {
+        candidateCount = args.complete(completeArgc, const_cast<char**>(completeArgv), 2).size();
+    }
+    end = std::clock();
+
+    std::printf("complete x%lu: %.3f ms/complete, %lu candidates\n", static_cast<unsigned long>(count),
+                (end - start) * 1000.0 / CLOCKS_PER_SEC / loop, static_cast<unsigned long>(candidateCount));
+    return 0;
+}
@@ -0,0 +1,67 @@
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <new>
+#include <string>
+#include <vector>
+
+#include "blet/args.h"
+
+static std::size_t s_allocationCount = 0;
+
+void* operator new(std::size_t size) {
+    ++s_allocationCount;
+    void* ptr = std::malloc(size == 0 ? 1 : size);
+    if (ptr == NULL) {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+void operator delete(void* ptr) throw() {
+    std::free(ptr);
+}
+
+#if __cplusplus >= 201402L
+void operator delete(void* ptr, std::size_t) throw() {
+    std::free(ptr);
+}
+#endif
+
+int main(int argc, char* argv[]) {
+    std::size_t count = (argc > 1) ? std::strtoul(argv[1], NULL, 10) : 10000;
+    std::size_t loop = (argc > 2) ? std::strtoul(argv[2], NULL, 10) : 100;
+
+    // binaryName --point 0 1 2 --point 1 2 3 ...
+    std::vector<std::string> values;
+    values.push_back("binaryName");
+    for (std::size_t i = 0; i < count; ++i) {
+        char buffer[32];
+        values.push_back("--point");
+        for (std::size_t j = 0; j < 3; ++j) {
+            std::sprintf(buffer, "%lu", static_cast<unsigned long>(i + j));
+            values.push_back(buffer);
+        }
+    }
+    std::vector<char*> arguments;
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        arguments.push_back(const_cast<char*>(values[i].c_str()));
+    }
+
+    std::vector<std::vector<double> > points;
+    blet::Args args;
+    args.addArgument("--point").action(args.APPEND).nargs(3).dest(points);
+
+    std::size_t allocationCount = s_allocationCount;
+    std::clock_t start = std::clock();
+    for (std::size_t i = 0; i < loop; ++i) {
+        points.clear();
+        args.parseArguments(static_cast<int>(arguments.size()), &arguments[0]);
+    }
+    std::clock_t end = std::clock();
+    allocationCount = s_allocationCount - allocationCount;
+
+    std::printf("MULTI_NUMBER_OPTION x%lu: %.3f ms/parse, %lu allocations/parse\n", static_cast<unsigned long>(count),
+                (end - start) * 1000.0 / CLOCKS_PER_SEC / loop, static_cast<unsigned long>(allocationCount / loop));
+    return 0;
+}
@@ -0,0 +1,393 @@
+/**
+ * blet_args_codegen.cpp
+ *
+ * Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+ * Copyright (c) 2022-2023 BLET Mickael.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "blet/args.h"
+#include "blet/args/utils.h"
+
+/**
+ * @brief Argument read from a section of spec file
+ */
+struct SpecArgument {
+    std::size_t line;
+    std::vector<std::string> nameOrFlags;
+    std::string action;
+    std::size_t nargs;
+    std::vector<std::string> defaults;
+    std::string help;
+    std::string metavar;
+    bool hasHelp;
+    bool hasMetavar;
+    bool isRequired;
+};
+
+struct SpecKey {
+    std::string nameOrFlag;
+    std::size_t argument;
+};
+
+static inline std::string s_trim(const std::string& str) {
+    std::size_t begin = 0;
+    std::size_t end = str.size();
+    while (begin < end && ::isspace(static_cast<unsigned char>(str[begin]))) {
+        ++begin;
+    }
+    while (end > begin && ::isspace(static_cast<unsigned char>(str[end - 1]))) {
+        --end;
+    }
+    return str.substr(begin, end - begin);
+}
+
+static inline std::vector<std::string> s_split(const std::string& str) {
+    std::vector<std::string> ret;
+    std::istringstream iss(str);
+    std::string word;
+    while (iss >> word) {
+        ret.push_back(word);
+    }
+    return ret;
+}
+
+static inline void s_error(const std::string& filename, std::size_t line, const std::string& message) {
+    std::cerr << filename << ':' << line << ": " << message << std::endl;
+    ::exit(1);
+}
+
+static inline bool s_action(const std::string& name, enum blet::args::Action::eAction* action) {
+    static const char* const actions[] = {"none",        "help",   "version", "store_true",
+                                          "store_false", "append", "extend",  "infinite"};
+    for (std::size_t i = 0; i < sizeof(actions) / sizeof(*actions); ++i) {
+        if (name == actions[i]) {
+            *action = static_cast<enum blet::args::Action::eAction>(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+static inline std::string s_actionName(const std::string& action) {
+    std::string ret(action);
+    for (std::size_t i = 0; i < ret.size(); ++i) {
+        ret[i] = static_cast<char>(::toupper(static_cast<unsigned char>(ret[i])));
+    }
+    return "blet::args::Action::" + ret;
+}
+
+static inline std::string s_quote(const std::string& str) {
+    std::string ret("\"");
+    for (std::size_t i = 0; i < str.size(); ++i) {
+        unsigned char c = static_cast<unsigned char>(str[i]);
+        if (c == '"' || c == '\\') {
+            ret += '\\';
+            ret += str[i];
+        }
+        else if (c == '\n') {
+            ret += "\\n";
+        }
+        else if (c == '\t') {
+            ret += "\\t";
+        }
+        else if (c < 0x20 || c == 0x7F) {
+            char octal[5] = {'\\', static_cast<char>('0' + (c >> 6)), static_cast<char>('0' + ((c >> 3) & 7)),
+                             static_cast<char>('0' + (c & 7)), '\0'};
+            ret += octal;
+        }
+        else {
+            ret += str[i];
+        }
+    }
+    ret += '"';
+    return ret;
+}
+
+/**
+ * @brief Read the sections of spec file
+ *
+ * @code
+ * # comment
+ * [-v --verbose]
+ * action = store_true
+ * help = verbose mode
+ *
+ * [--number]
+ * nargs = 2
+ * defaults = 1 2
+ * metavar = N
+ *
+ * [FILE]
+ * nargs = +
+ * required = true
+ * @endcode
+ */
+static std::vector<SpecArgument> s_readSpec(const std::string& filename) {
+    std::ifstream ifs(filename.c_str());
+    if (!ifs.is_open()) {
+        s_error(filename, 0, "cannot open file");
+    }
+    std::vector<SpecArgument> specArguments;
+    std::string line;
+    std::size_t lineNumber = 0;
+    while (std::getline(ifs, line)) {
+        ++lineNumber;
+        line = s_trim(line);
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+        if (line[0] == '[') {
+            if (line[line.size() - 1] != ']') {
+                s_error(filename, lineNumber, "section not closed by ']'");
+            }
+            SpecArgument specArgument;
+            specArgument.line = lineNumber;
+            specArgument.nameOrFlags = s_split(line.substr(1, line.size() - 2));
+            specArgument.action = "none";
+            specArgument.nargs = 1;
+            specArgument.hasHelp = false;
+            specArgument.hasMetavar = false;
+            specArgument.isRequired = false;
+            if (specArgument.nameOrFlags.empty()) {
+                s_error(filename, lineNumber, "empty section");
+            }
+            specArguments.push_back(specArgument);
+            continue;
+        }
+        std::size_t equal = line.find('=');
+        if (equal == std::string::npos) {
+            s_error(filename, lineNumber, "line is not a section or a 'key = value'");
+        }
+        if (specArguments.empty()) {
+            s_error(filename, lineNumber, "key outside of section");
+        }
+        SpecArgument& specArgument = specArguments.back();
+        std::string key = s_trim(line.substr(0, equal));
+        std::string value = s_trim(line.substr(equal + 1));
+        if (key == "action") {
+            enum blet::args::Action::eAction action;
+            if (!s_action(value, &action)) {
+                s_error(filename, lineNumber, "invalid action '" + value + "'");
+            }
+            specArgument.action = value;
+        }
+        else if (key == "nargs") {
+            if (value == "+") {
+                specArgument.nargs = '+';
+            }
+            else {
+                char* end = NULL;
+                specArgument.nargs = static_cast<std::size_t>(::strtoul(value.c_str(), &end, 10));
+                if (value.empty() || *end != '\0') {
+                    s_error(filename, lineNumber, "invalid nargs '" + value + "'");
+                }
+            }
+        }
+        else if (key == "defaults") {
+            specArgument.defaults = s_split(value);
+        }
+        else if (key == "help") {
+            specArgument.help = value;
+            specArgument.hasHelp = true;
+        }
+        else if (key == "metavar") {
+            specArgument.metavar = value;
+            specArgument.hasMetavar = true;
+        }
+        else if (key == "required") {
+            if (value != "true" && value != "false") {
+                s_error(filename, lineNumber, "invalid required '" + value + "'");
+            }
+            specArgument.isRequired = (value == "true");
+        }
+        else {
+            s_error(filename, lineNumber, "invalid key '" + key + "'");
+        }
+    }
+    if (specArguments.empty()) {
+        s_error(filename, lineNumber, "no argument in spec");
+    }
+    return specArguments;
+}
+
+/**
+ * @brief Check the arguments with the same rules of runtime declaration
+ */
+static void s_validSpec(const std::string& filename, const std::vector<SpecArgument>& specArguments) {
+    std::set<std::string> names;
+    std::set<std::string> uniqueActions;
+    for (std::size_t i = 0; i < specArguments.size(); ++i) {
+        const SpecArgument& specArgument = specArguments[i];
+        try {
+            blet::args::Vector nameOrFlags;
+            nameOrFlags.assign(specArgument.nameOrFlags.begin(), specArgument.nameOrFlags.end());
+            for (std::size_t j = 0; j < nameOrFlags.size(); ++j) {
+                if (!names.insert(nameOrFlags[j]).second) {
+                    throw blet::Args::ArgumentException(nameOrFlags[j].c_str(), "invalid flag already exist");
+                }
+            }
+            if ((specArgument.action == "help" || specArgument.action == "version") &&
+                !uniqueActions.insert(specArgument.action).second) {
+                throw blet::Args::ArgumentException(nameOrFlags[0].c_str(),
+                                                    (specArgument.action + " action already defined").c_str());
+            }
+            enum blet::args::Action::eAction action = blet::args::Action::NONE;
+            s_action(specArgument.action, &action);
+            // one object by argument for not sort all arguments at each declaration
+            blet::Args args(false);
+            blet::args::Argument& argument = args.addArgument(nameOrFlags);
+            argument.nargs(specArgument.nargs).action(action);
+            if (!specArgument.defaults.empty()) {
+                blet::args::Vector defaults;
+                defaults.assign(specArgument.defaults.begin(), specArgument.defaults.end());
+                argument.defaults(defaults);
+            }
+        }
+        catch (const blet::Args::ArgumentException& e) {
+            s_error(filename, specArgument.line, std::string(e.argument()) + ": " + e.what());
+        }
+    }
+}
+
+static void s_writeHeader(std::ostream& os, const std::string& spec, const std::string& name,
+                          const std::vector<SpecArgument>& specArguments) {
+    std::vector<SpecKey> keys;
+    std::vector<std::size_t> shortOptions(128, 0);
+    for (std::size_t i = 0; i < specArguments.size(); ++i) {
+        for (std::size_t j = 0; j < specArguments[i].nameOrFlags.size(); ++j) {
+            SpecKey key;
+            key.nameOrFlag = specArguments[i].nameOrFlags[j];
+            key.argument = i;
+            keys.push_back(key);
+            if (blet::args::isShortOption(key.nameOrFlag.c_str()) &&
+                static_cast<unsigned char>(key.nameOrFlag[1]) < 128) {
+                shortOptions[static_cast<unsigned char>(key.nameOrFlag[1])] = i + 1;
+            }
+        }
+    }
+    std::vector<std::string> nameOrFlags;
+    for (std::size_t i = 0; i < keys.size(); ++i) {
+        nameOrFlags.push_back(keys[i].nameOrFlag);
+    }
+    std::vector<std::size_t> slots;
+    std::vector<unsigned int> displacements;
+    blet::args::tableBuildPerfectHash(nameOrFlags, &slots, &displacements);
+
+    std::string guard("BLET_ARGS_GENERATED_");
+    for (std::size_t i = 0; i < name.size(); ++i) {
+        guard += ::isalnum(static_cast<unsigned char>(name[i])) ? static_cast<char>(::toupper(static_cast<unsigned char>(name[i]))) : '_';
+    }
+    guard += "_H_";
+
+    os << "// Generated by blet_args_codegen from " << spec << ", do not edit.\n\n";
+    os << "#ifndef " << guard << "\n#define " << guard << "\n\n";
+    os << "#include <cstddef>\n\n#include \"blet/args/table.h\"\n\n";
+    for (std::size_t i = 0; i < specArguments.size(); ++i) {
+        os << "static const char* const " << name << "_nameOrFlags_" << i << "[] = {";
+        for (std::size_t j = 0; j < specArguments[i].nameOrFlags.size(); ++j) {
+            os << (j > 0 ? ", " : "") << s_quote(specArguments[i].nameOrFlags[j]);
+        }
+        os << "};\n";
+        if (!specArguments[i].defaults.empty()) {
+            os << "static const char* const " << name << "_defaults_" << i << "[] = {";
+            for (std::size_t j = 0; j < specArguments[i].defaults.size(); ++j) {
+                os << (j > 0 ? ", " : "") << s_quote(specArguments[i].defaults[j]);
+            }
+            os << "};\n";
+        }
+    }
+    os << "\nstatic const blet::args::TableArgument " << name << "_arguments[] = {\n";
+    for (std::size_t i = 0; i < specArguments.size(); ++i) {
+        const SpecArgument& specArgument = specArguments[i];
+        os << "    {" << name << "_nameOrFlags_" << i << ", " << specArgument.nameOrFlags.size() << ", "
+           << s_actionName(specArgument.action) << ", " << specArgument.nargs << ", ";
+        if (specArgument.defaults.empty()) {
+            os << "NULL, 0, ";
+        }
+        else {
+            os << name << "_defaults_" << i << ", " << specArgument.defaults.size() << ", ";
+        }
+        os << (specArgument.hasHelp ? s_quote(specArgument.help) : "NULL") << ", "
+           << (specArgument.hasMetavar ? s_quote(specArgument.metavar) : "NULL") << ", "
+           << (specArgument.isRequired ? "true" : "false") << "},\n";
+    }
+    os << "};\n\nstatic const blet::args::TableSlot " << name << "_slots[] = {\n";
+    for (std::size_t i = 0; i < slots.size(); ++i) {
+        if (slots[i] == 0) {
+            os << "    {NULL, 0},\n";
+        }
+        else {
+            const SpecKey& key = keys[slots[i] - 1];
+            os << "    {" << s_quote(key.nameOrFlag) << ", " << key.argument << "},\n";
+        }
+    }
+    os << "};\n\nstatic const unsigned int " << name << "_displacements[] = {";
+    for (std::size_t i = 0; i < displacements.size(); ++i) {
+        os << (i % 16 == 0 ? "\n    " : " ") << displacements[i] << "U,";
+    }
+    os << "\n};\n\nstatic const std::size_t " << name << "_shortOptions[128] = {";
+    for (std::size_t i = 0; i < shortOptions.size(); ++i) {
+        os << (i % 16 == 0 ? "\n    " : " ") << shortOptions[i] << ",";
+    }
+    os << "\n};\n\nstatic const blet::args::Table " << name << " = {" << name << "_arguments, "
+       << specArguments.size() << ", " << name << "_slots, " << slots.size() << ", " << name << "_displacements, "
+       << displacements.size() << ", " << name << "_shortOptions};\n\n";
+    os << "#endif // #ifndef " << guard << "\n";
+}
+
+int main(int argc, char* argv[]) {
+    std::string spec;
+    std::string output;
+    std::string name;
+
+    blet::Args args;
+    args.setDescription("Generate a C++ header of arguments table with a perfect hash from a spec file");
+    args.addArgument("SPEC").help("spec file").dest(spec);
+    args.addArgument("OUTPUT").help("generated header").dest(output);
+    args.addArgument("--name").help("name of table variable").defaults("argsTable").dest(name);
+    try {
+        args.parseArguments(argc, argv);
+    }
+    catch (const blet::Args::ParseArgumentException& e) {
+        std::cerr << args.getBinaryName() << ": " << e.what() << " -- '" << e.argument() << "'" << std::endl;
+        return 1;
+    }
+
+    std::vector<SpecArgument> specArguments = s_readSpec(spec);
+    s_validSpec(spec, specArguments);
+
+    std::ofstream ofs(output.c_str());
+    if (!ofs.is_open()) {
+        s_error(output, 0, "cannot open file");
+    }
+    s_writeHeader(ofs, spec, name, specArguments);
+    return 0;
+}
@@ -29,8 +29,13 @@
 #include "blet/args/action.h"
 #include "blet/args/args.h"
 #include "blet/args/exception.h"
+#include "blet/args/field.h"
+#include "blet/args/response.h"
+#include "blet/args/spec.h"
+#include "blet/args/table.h"
 #include "blet/args/valid.h"
 #include "blet/args/vector.h"
+#include "blet/args/view.h"
 
 namespace blet {
 
@@ -56,6 +61,40 @@ class Args : public args::Args, public args::Action {
     typedef args::ValidMinMax ValidMinMax;
     typedef args::ValidPath ValidPath;
 
+    typedef args::ResponseFile ResponseFile;
+    typedef args::Table Table;
+    typedef args::Field Field;
+
+    typedef args::StringView StringView;
+    typedef args::ValueRange ValueRange;
+    typedef args::GroupRange GroupRange;
+    typedef args::Handle Handle;
+
+#if __cplusplus >= 201703L
+    typedef args::OptionSpec OptionSpec;
+
+    /**
+     * @brief Create a option spec usable in a constant expression
+     *
+     * @param nameOrFlag
+     * @return OptionSpec
+     */
+    static constexpr OptionSpec option(const char* nameOrFlag) {
+        return OptionSpec(nameOrFlag);
+    }
+
+    /**
+     * @brief Create a static table of option specs checked in a constant expression
+     *
+     * @param options
+     * @return args::Spec<sizeof...(T)>
+     */
+    template<typename... T>
+    static constexpr args::Spec<sizeof...(T)> spec(const T&... options) {
+        return args::Spec<sizeof...(T)>(options...);
+    }
+#endif
+
 /**
  * @brief Generate static vector methods
  */
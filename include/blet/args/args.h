@@ -26,14 +26,19 @@
 #ifndef BLET_ARGS_ARGS_H_
 #define BLET_ARGS_ARGS_H_
 
-#include <list>
 #include <map>
 #include <string>
 #include <vector>
 
 #include "blet/args/action.h"
 #include "blet/args/argument.h"
+#include "blet/args/constraint.h"
 #include "blet/args/exception.h"
+#include "blet/args/field.h"
+#include "blet/args/response.h"
+#include "blet/args/snapshot.h"
+#include "blet/args/spec.h"
+#include "blet/args/table.h"
 #include "blet/args/usage.h"
 #include "blet/args/vector.h"
 
@@ -119,6 +124,25 @@ class Args : public Usage {
         return isStrict_;
     }
 
+    /**
+     * @brief Accept the unambiguous prefixes of long options, e.g. --verb for --verbose
+     *
+     * @param abbreviation
+     */
+    Args& setAbbreviation(bool abbreviation = true) {
+        isAbbreviation_ = abbreviation;
+        return *this;
+    }
+
+    /**
+     * @brief Get the status of abbreviation
+     *
+     * @return [true] at abbreviation
+     */
+    bool isAbbreviation() const {
+        return isAbbreviation_;
+    }
+
     /**
      * @brief Throw a HelpException when help action is present in arguments; otherwise, exit(0) after outputting usage
      * to stdout
@@ -159,6 +183,46 @@ class Args : public Usage {
         return isVersionException_;
     }
 
+    /**
+     * @brief Expand the "@path" arguments with the content of the file at parseArguments.
+     *        The file is memory-mapped and split by line, NUL character or shell quoted words following the mode
+     *
+     * @param mode
+     */
+    Args& setResponseFile(enum ResponseFile::eMode mode = ResponseFile::NEWLINE) {
+        responseFile_ = mode;
+        return *this;
+    }
+
+    /**
+     * @brief Get the mode of response file
+     *
+     * @return enum ResponseFile::eMode
+     */
+    enum ResponseFile::eMode getResponseFile() const {
+        return responseFile_;
+    }
+
+    /**
+     * @brief Keep a pointer on the help and metavar strings of next arguments instead of a copy.
+     *        The strings must live as long as the arguments (e.g. string literals).
+     *
+     * @param literalHelp
+     */
+    Args& setLiteralHelp(bool literalHelp = true) {
+        isLiteralHelp_ = literalHelp;
+        return *this;
+    }
+
+    /**
+     * @brief Get the status of literal help
+     *
+     * @return [true] at literal help
+     */
+    bool isLiteralHelp() const {
+        return isLiteralHelp_;
+    }
+
     /**
      * @brief Set the binary name
      *
@@ -166,6 +230,7 @@ class Args : public Usage {
      */
     void setBinaryName(const char* binaryName) {
         binaryName_ = binaryName;
+        clearUsageCache_();
     }
 
     /**
@@ -184,7 +249,7 @@ class Args : public Usage {
      * @return [true] argument is in map, [false] argument is not in map
      */
     bool argumentExists(const std::string& nameOrFlag) const {
-        return (argumentFromName_.find(nameOrFlag) != argumentFromName_.end());
+        return findArgument_(nameOrFlag) != NULL;
     }
 
     /**
@@ -194,11 +259,11 @@ class Args : public Usage {
      * @return const Argument&
      */
     const Argument& getArgument(const std::string& nameOrFlag) const {
-        std::map<std::string, Argument**>::const_iterator cit = argumentFromName_.find(nameOrFlag);
-        if (cit == argumentFromName_.end()) {
+        const Argument* argument = findArgument_(nameOrFlag);
+        if (argument == NULL) {
             throw AccessDeniedException(nameOrFlag.c_str(), "argument not found");
         }
-        return **(cit->second);
+        return *argument;
     }
 
     /**
@@ -211,6 +276,34 @@ class Args : public Usage {
         return getArgument(nameOrFlag);
     }
 
+    /**
+     * @brief Get the argument object from its handle without string lookup
+     *
+     * @param handle
+     * @return const Argument&
+     *
+     * @throw AccessDeniedException if the argument was removed, the object was cleared or the handle is not from
+     *        this object
+     */
+    const Argument& getArgument(const Handle& handle) const {
+        if (handle.args_ != this || handle.index_ >= argumentFromIndex_.size() ||
+            argumentFromIndex_[handle.index_] == NULL ||
+            argumentFromIndex_[handle.index_]->generation_ != handle.generation_) {
+            throw AccessDeniedException("", "argument not found");
+        }
+        return *argumentFromIndex_[handle.index_];
+    }
+
+    /**
+     * @brief Override bracket operator with getArgument
+     *
+     * @param handle
+     * @return const Argument&
+     */
+    const Argument& operator[](const Handle& handle) const {
+        return getArgument(handle);
+    }
+
     /**
      * @brief Get the vector of additional argument
      *
@@ -235,6 +328,47 @@ class Args : public Usage {
      */
     void parseArguments(int argc, char* argv[]);
 
+    /**
+     * @brief Convert argument strings like parseArguments and write the values of arguments directly in the fields
+     *        of object
+     *
+     * @tparam S type of struct
+     * @tparam N number of fields
+     * @param argc
+     * @param argv
+     * @param object struct to fill
+     * @param fields table of ARGS_FIELD
+     *
+     * @throw HelpException if setHelpException is active
+     * @throw VersionException if setVersionException is active
+     * @throw ParseArgumentRequiredException
+     * @throw ParseArgumentValidException
+     * @throw ParseArgumentException
+     * @throw AccessDeniedException if a argument of fields not exists, before the parse
+     */
+    template<typename S, std::size_t N>
+    void parseArguments(int argc, char* argv[], S& object, const Field (&fields)[N]) {
+        // the fields are found before the parse for not write the dests with a bad table
+        const Argument* arguments[N];
+        findFields_(fields, arguments, N);
+        parseArguments(argc, argv);
+        toFields_(&object, fields, arguments, N);
+    }
+
+    /**
+     * @brief Get the candidates of completion of the word at @p cursorIndex.
+     *        The words before the cursor are read to find the option which waits values or the subcommand,
+     *        no value is stored and no validator, dest or required check is called.
+     *        Candidates are the flags if the word starts by '-', the choises of the valid of option which waits
+     *        values or the names of subcommands.
+     *
+     * @param argc
+     * @param argv
+     * @param cursorIndex index of the word to complete, if equal to argc the word is empty
+     * @return std::vector<std::string> candidates
+     */
+    std::vector<std::string> complete(int argc, char* argv[], int cursorIndex);
+
     /**
      * @brief Define how a single command-line argument should be parsed
      *
@@ -246,6 +380,97 @@ class Args : public Usage {
      */
     Argument& addArgument(const Vector& nameOrFlags);
 
+#if __cplusplus >= 201103L
+    /**
+     * @brief Define how a single command-line argument should be parsed
+     *
+     * @param nameOrFlags Either a name or a list of option strings, e.g. foo or -f, --foo moved in argument
+     *
+     * @return Argument& ref of new argument object
+     *
+     * @throw ArgumentException
+     */
+    Argument& addArgument(Vector&& nameOrFlags);
+#endif
+
+    /**
+     * @brief Define the arguments from a table generated by blet_args_codegen.
+     *        The strings of table are kept by pointer and its perfect hash is used to find the flags at parse.
+     *
+     * @param table
+     *
+     * @throw ArgumentException if a flag, the help or version action of table already exists in this object or if
+     *        an argument of table is invalid, no argument of table is added
+     */
+    void addArguments(const Table& table);
+
+    /**
+     * @brief Save the arguments (flags, types, nargs, defaults, help, metavar, order and perfect hash of flags),
+     *        the description, the epilog, the usage and the version in a binary file.
+     *        The valid and dest of arguments are not saved.
+     *
+     * @param filename
+     *
+     * @throw Exception
+     */
+    void saveSnapshot(const char* filename) const;
+
+    /**
+     * @brief Define the arguments from a file of saveSnapshot.
+     *        The file is memory-mapped for the life of this object and its strings are used in place.
+     *
+     * @param filename
+     *
+     * @throw Exception if the file is not a snapshot of this version
+     * @throw ArgumentException if a flag of snapshot already exists in this object
+     */
+    void loadSnapshot(const char* filename);
+
+#if __cplusplus >= 201703L
+    /**
+     * @brief Define the arguments from a static table checked at compile time.
+     *        The arguments are created in bulk like addArguments(const Table&) without the checks already done by
+     *        the spec, the help and metavar strings of spec are kept by pointer, the names, flags and defaults are
+     *        copied.
+     *
+     * @tparam N number of arguments
+     * @param spec
+     *
+     * @throw ArgumentException if a flag, the help or version action of spec already exists in this object
+     */
+    template<std::size_t N>
+    void addArguments(const Spec<N>& spec) {
+        // the spec has no duplicate, check only the conflicts with this object
+        for (std::size_t i = 0; i < N; ++i) {
+            const OptionSpec& option = spec[i];
+            for (std::size_t j = 0; j < option.flagCount(); ++j) {
+                if (findArgument_(option.nameOrFlag(j)) != NULL) {
+                    throw ArgumentException(option.nameOrFlag(j), "invalid flag already exist");
+                }
+            }
+            if (option.getAction() == Action::HELP && helpOption_ != NULL) {
+                throw ArgumentException(option.nameOrFlag(0), "help action already defined");
+            }
+            if (option.getAction() == Action::VERSION && versionOption_ != NULL) {
+                throw ArgumentException(option.nameOrFlag(0), "version action already defined");
+            }
+        }
+        arguments_.reserve(arguments_.size() + N);
+        for (std::size_t i = 0; i < N; ++i) {
+            const OptionSpec& option = spec[i];
+            const TableArgument tableArgument = {option.getNameOrFlags(), option.flagCount(), option.getAction(),
+                                                 option.getNargs(),       option.getDefaults(), option.defaultCount(),
+                                                 option.getHelp(),        option.getMetavar(),  option.isRequired()};
+            Argument* argument = newTableArgument_(tableArgument);
+            for (std::size_t j = 0; j < argument->nameOrFlags_.size(); ++j) {
+                argumentFromName_.insert(std::pair<std::string, Argument*>(argument->nameOrFlags_[j], argument));
+            }
+        }
+        sortArguments_();
+        clearUsageCache_();
+    }
+#endif
+
     /**
      * @brief Get the ref. of argument from name or flag
      *
@@ -255,13 +480,85 @@ class Args : public Usage {
      * @throw ArgumentException
      */
     Argument& updateArgument(const std::string& nameOrFlag) {
-        std::map<std::string, Argument**>::iterator it = argumentFromName_.find(nameOrFlag);
-        if (it == argumentFromName_.end()) {
+        Argument* argument = findArgument_(nameOrFlag);
+        if (argument == NULL) {
             throw AccessDeniedException(nameOrFlag.c_str(), "argument not found");
         }
-        return **(it->second);
+        return *argument;
+    }
+
+    /**
+     * @brief Add a group of arguments where only one argument can be used in the command line
+     *
+     * @param nameOrFlags names or flags of the arguments of group
+     * @param required__ one argument of group is required
+     *
+     * @throw ArgumentException
+     */
+    void addExclusiveGroup(const Vector& nameOrFlags, bool required__ = false);
+
+    /**
+     * @brief Add the arguments required when the argument nameOrFlag is used in the command line
+     *
+     * @param nameOrFlag
+     * @param requiredNameOrFlags
+     *
+     * @throw ArgumentException
+     */
+    void addRequirement(const std::string& nameOrFlag, const Vector& requiredNameOrFlags);
+
+    /**
+     * @brief Add the arguments not allowed when the argument nameOrFlag is used in the command line
+     *
+     * @param nameOrFlag
+     * @param conflictNameOrFlags
+     *
+     * @throw ArgumentException
+     */
+    void addConflict(const std::string& nameOrFlag, const Vector& conflictNameOrFlags);
+
+    /**
+     * @brief Add a subcommand, its arguments are defined by factory only when the subcommand is used
+     *
+     * @tparam T type of Args object of subcommand
+     * @param name
+     * @param factory function called with the new Args object of subcommand
+     * @param help
+     *
+     * @throw ArgumentException
+     */
+    template<typename T>
+    void addSubcommand(const std::string& name, void (*factory)(T& subcommand), const std::string& help = "") {
+        addSubcommand_(name, reinterpret_cast<void (*)()>(factory), &newSubcommand_<T>, &buildSubcommand_<T>,
+                       help);
     }
 
+    /**
+     * @brief Get the name of subcommand selected by the last parse
+     *
+     * @return const std::string& name or empty string if no subcommand is selected
+     */
+    const std::string& getSubcommandName() const;
+
+    /**
+     * @brief Get the Args object of subcommand selected by the last parse
+     *
+     * @return Args&
+     *
+     * @throw AccessDeniedException
+     */
+    Args& getSubcommand();
+
+    /**
+     * @brief Get the Args object of subcommand, it is built by its factory at the first call
+     *
+     * @param name
+     * @return Args&
+     *
+     * @throw AccessDeniedException
+     */
+    Args& getSubcommand(const std::string& name);
+
     /**
      * @brief Remove previously arguments
      *
@@ -276,10 +573,241 @@ class Args : public Usage {
      */
     void clear();
 
+    /**
+     * @brief Get the approximate number of bytes used by this object, its arguments, their values and its indexes
+     *
+     * @return std::size_t
+     */
+    std::size_t memoryUsage() const;
+
   private:
     Args(const Args&);            // disable copy constructor
     Args& operator=(const Args&); // disable copy operator
 
+    /**
+     * @brief Parse the arguments after the expansion of response files
+     *
+     * @param argc
+     * @param argv
+     */
+    void parseArguments_(int argc, const Tokens& argv);
+
+    /**
+     * @brief Common part of addArgument, the strings of nameOrFlags are moved in the new argument
+     *
+     * @param nameOrFlags
+     * @return Argument&
+     *
+     * @throw ArgumentException
+     */
+    Argument& addArgument_(Vector& nameOrFlags);
+
+    /**
+     * @brief Construct a new argument in a free slot of the blocks of arguments,
+     *        a new block as large as all the previous blocks is allocated if no slot is free
+     *
+     * @return Argument* new argument
+     */
+    Argument* newArgument_();
+
+    /**
+     * @brief Destroy the argument and give its slot back to the free slots
+     *
+     * @param argument
+     */
+    void deleteArgument_(Argument* argument);
+
+    /**
+     * @brief Destroy the arguments created after the first size arguments by a failed bulk creation
+     *
+     * @param size
+     */
+    void deleteLastArguments_(std::size_t size);
+
+    /**
+     * @brief Destroy all the arguments and release the blocks of arguments
+     */
+    void deleteArguments_();
+
+    /**
+     * @brief Set or unset the bit of index in the packed bits
+     *
+     * @param bits
+     * @param index
+     * @param value
+     */
+    static void setBit_(std::vector<unsigned long>& bits, std::size_t index, bool value);
+
+    /**
+     * @brief Compile a new constraint with the arguments of nameOrFlags
+     *
+     * @param constraint
+     * @param nameOrFlags
+     *
+     * @throw ArgumentException
+     */
+    void addConstraint_(Constraint& constraint, const Vector& nameOrFlags);
+
+    /**
+     * @brief Check the constraints after the parse, the first violated constraint is reported
+     *
+     * @throw ParseArgumentException
+     * @throw ParseArgumentRequiredException
+     */
+    void checkConstraints_() const;
+
+    /**
+     * @brief Subcommand and its Args object built at the first use
+     */
+    struct Subcommand {
+        std::string name;
+        std::string help;
+        void (*factory)();
+        Args* (*newArgs)(bool addHelp);
+        void (*buildArgs)(Args& args, void (*factory)());
+        Args* args;
+    };
+
+    template<typename T>
+    static Args* newSubcommand_(bool addHelp) {
+        return new T(addHelp);
+    }
+
+    template<typename T>
+    static void buildSubcommand_(Args& args, void (*factory)()) {
+        reinterpret_cast<void (*)(T&)>(factory)(static_cast<T&>(args));
+    }
+
+    /**
+     * @brief Add a subcommand with the typed functions of addSubcommand
+     *
+     * @param name
+     * @param factory
+     * @param newArgs
+     * @param buildArgs
+     * @param help
+     *
+     * @throw ArgumentException
+     */
+    void addSubcommand_(const std::string& name, void (*factory)(), Args* (*newArgs)(bool addHelp),
+                        void (*buildArgs)(Args& args, void (*factory)()), const std::string& help);
+
+    /**
+     * @brief Find the subcommand in the hash table of subcommands
+     *
+     * @param name
+     * @return std::size_t index of subcommand or subcommands_.size() if not found
+     */
+    std::size_t findSubcommand_(const char* name) const;
+
+    /**
+     * @brief Insert the index of subcommand in the hash table of subcommands, the table grows at half full
+     *
+     * @param index
+     */
+    void insertSubcommand_(std::size_t index);
+
+    /**
+     * @brief Get the Args object of subcommand, it is built by its factory at the first call
+     *
+     * @param subcommand
+     * @return Args&
+     */
+    Args& subcommandArgs_(Subcommand& subcommand);
+
+    /**
+     * @brief Delete the Args objects of subcommands
+     */
+    void deleteSubcommands_();
+
+    /**
+     * @brief Mark the argument as present in the command line
+     *
+     * @param argument
+     */
+    void setExist_(Argument* argument);
+
+    /**
+     * @brief Find the option of the token before the cursor of completion
+     *
+     * @param token
+     * @param valueCount number of values waited by the option, npos if the option waits values until the next option
+     * @return Argument* argument or NULL if not found
+     */
+    Argument* completeOption_(const char* token, std::size_t* valueCount);
+
+    /**
+     * @brief Sort the flags of options in a flat array at the first call after a change of arguments
+     */
+    void sortFlags_() const;
+
+    /**
+     * @brief Find the argument of the long option which starts by prefix
+     *
+     * @param prefix
+     * @return Argument* argument or NULL if not found
+     *
+     * @throw ParseArgumentException if prefix is ambiguous
+     */
+    Argument* findAbbreviation_(const std::string& prefix) const;
+
+    /**
+     * @brief Insert the argument in the sorted arguments after its equivalents
+     *
+     * @param argument
+     */
+    void insertArgument_(Argument* argument);
+
+    /**
+     * @brief Sort the arguments in the order of usage, the order of equivalent arguments is kept
+     */
+    void sortArguments_();
+
+    /**
+     * @brief Move the elements in the pool of elements, the capacities of elements are kept for the next parse
+     *
+     * @param elements
+     */
+    void recycleElements_(ArgumentElement& elements);
+
+    /**
+     * @brief Add a new empty element at the end of elements, the storage is taken from the pool if possible
+     *
+     * @param elements
+     * @return ArgumentElement& new element
+     */
+    ArgumentElement& newElement_(ArgumentElement& elements);
+
+    /**
+     * @brief Add a new element of value at the end of elements, the storage is taken from the pool if possible
+     *
+     * @param elements
+     * @param value
+     * @return ArgumentElement& new element
+     */
+    ArgumentElement& newElement_(ArgumentElement& elements, const char* value);
+
+    /**
+     * @brief Find the argument of each field
+     *
+     * @param fields
+     * @param arguments the arguments of fields
+     * @param size
+     *
+     * @throw AccessDeniedException
+     */
+    void findFields_(const Field* fields, const Argument** arguments, std::size_t size) const;
+
+    /**
+     * @brief Write the values of arguments in the fields of object
+     *
+     * @param object
+     * @param fields
+     * @param arguments the arguments of fields found by findFields_
+     * @param size
+     */
+    void toFields_(void* object, const Field* fields, const Argument* const* arguments, std::size_t size) const;
+
     /**
      * @brief Get the short argument decompose multi short argument
      *
@@ -287,7 +815,7 @@ class Args : public Usage {
      * @param argv
      * @param index
      */
-    void parseShortArgument_(int maxIndex, char* argv[], int* index);
+    void parseShortArgument_(int maxIndex, const Tokens& argv, int* index);
 
     /**
      * @brief Get the long argument
@@ -296,7 +824,7 @@ class Args : public Usage {
      * @param argv
      * @param index
      */
-    void parseLongArgument_(int maxIndex, char* argv[], int* index);
+    void parseLongArgument_(int maxIndex, const Tokens& argv, int* index);
 
     /**
      * @brief Get the argument
@@ -310,9 +838,29 @@ class Args : public Usage {
      * @param argument
      * @param alternative
      */
-    void parseArgument_(int maxIndex, char* argv[], int* index, bool hasArg, const char* option, const char* arg,
+    void parseArgument_(int maxIndex, const Tokens& argv, int* index, bool hasArg, const char* option, const char* arg,
                         Argument* argument);
 
+    /**
+     * @brief Add a value in argument or the values of its input if value is "-"
+     *
+     * @param argument
+     * @param value
+     *
+     * @throw ParseArgumentException
+     */
+    void pushValue_(Argument* argument, const char* value);
+
+    /**
+     * @brief Add a value in argument or give it to the stream function of argument
+     *
+     * @param argument
+     * @param value
+     *
+     * @throw ParseArgumentValidException
+     */
+    void streamValue_(Argument* argument, const char* value);
+
     /**
      * @brief Get the positionnal argument
      *
@@ -320,7 +868,48 @@ class Args : public Usage {
      * @param index
      * @param strict
      */
-    void parsePositionnalArgument_(int argc, char* argv[], int* index, bool hasEndOption = false);
+    void parsePositionnalArgument_(int argc, const Tokens& argv, int* index, bool hasEndOption = false);
+
+    /**
+     * @brief Create the arguments of a mapped and checked snapshot in the arguments and the table arguments
+     *
+     * @param snapshot
+     *
+     * @throw ArgumentException
+     */
+    void loadSnapshotArguments_(const Snapshot& snapshot);
+
+    /**
+     * @brief Create an argument from a declaration of table or spec, the names and flags are not indexed
+     *
+     * @param tableArgument
+     * @return Argument* new argument pushed in the arguments
+     *
+     * @throw ArgumentException
+     */
+    Argument* newTableArgument_(const TableArgument& tableArgument);
+
+    /**
+     * @brief Move the names and flags of the table or snapshot index in the map of names and forget the indexes
+     *        of table and snapshot
+     */
+    void dropIndex_();
+
+    /**
+     * @brief Find a argument from the generated table, the snapshot or the map of names
+     *
+     * @param nameOrFlag
+     * @return Argument* or NULL if not found
+     */
+    Argument* findArgument_(const std::string& nameOrFlag) const;
+
+    /**
+     * @brief Find a short option from the generated table or the map of names
+     *
+     * @param option character of short option
+     * @return Argument* or NULL if not found
+     */
+    Argument* findShortArgument_(char option) const;
 
     /**
      * @brief Check end of infinite parsing
@@ -334,8 +923,30 @@ class Args : public Usage {
 
     std::string binaryName_;
 
-    std::list<Argument*> arguments_;
-    std::map<std::string, Argument**> argumentFromName_;
+    std::vector<Argument*> arguments_;
+    std::map<std::string, Argument*> argumentFromName_;
+    const Table* table_;
+    const Snapshot* snapshot_;
+    std::vector<Argument*> tableArguments_;
+    std::vector<Snapshot*> snapshots_;
+    std::vector<ArgumentElement> elementPool_;
+    std::vector<void*> argumentBlocks_;
+    std::vector<Argument*> freeArguments_;
+    std::vector<Argument*> argumentFromIndex_;
+    // indexes of the removed arguments
+    std::vector<std::size_t> freeIndexes_;
+    // generation of the next new argument, never reset for invalidate the handles after clear
+    unsigned int nextGeneration_;
+    // packed bits by index of argument
+    std::vector<unsigned long> existBits_;
+    std::vector<unsigned long> requiredBits_;
+    std::vector<unsigned long> destBits_;
+    std::vector<Constraint> constraints_;
+    std::vector<Subcommand> subcommands_;
+    // open addressing table of index + 1 of subcommands, 0 if empty
+    std::vector<std::size_t> subcommandSlots_;
+    // index + 1 of the subcommand selected by the last parse, 0 if not selected
+    std::size_t selectedSubcommand_;
 
     Argument* helpOption_;
     Argument* versionOption_;
@@ -346,9 +957,24 @@ class Args : public Usage {
     bool isStrict_;
     bool isHelpException_;
     bool isVersionException_;
+    enum ResponseFile::eMode responseFile_;
+    bool isLiteralHelp_;
+    bool isAbbreviation_;
     std::vector<std::string> additionalArguments_;
+
+    // sorted flags of options for the abbreviations and the completion
+    mutable std::vector<std::pair<const char*, Argument*> > sortedFlags_;
+    mutable bool hasSortedFlags_;
 };
 
+template<typename T>
+void Handle::get(T& result) const {
+    if (args_ == NULL) {
+        throw AccessDeniedException("", "argument not found");
+    }
+    ArgumentConverter<T>::to(args_->getArgument(*this), result);
+}
+
 } // namespace args
 
 } // namespace blet
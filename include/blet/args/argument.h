@@ -28,13 +28,20 @@
 
 #include <cstdlib> // stdtod
 #include <cstring> // memcpy
+#include <iterator>
 #include <string>
+#include <utility> // move
 #include <vector>
 
+#if __cplusplus >= 202002L
+#include <ranges>
+#endif
+
 #include "blet/args/action.h"
 #include "blet/args/exception.h"
 #include "blet/args/valid.h"
 #include "blet/args/vector.h"
+#include "blet/args/view.h"
 
 namespace blet {
 
@@ -238,58 +245,51 @@ inline void strTo(const std::string& str, char (&ret)[Size]) {
 
 class Args;
 
+class ValueIterator;
+
 class ArgumentElement : public std::vector<ArgumentElement> {
     friend class Args;
     friend class Argument;
     friend class Usage;
+    friend class ValueIterator;
 
   public:
     ArgumentElement();
     ArgumentElement(const ArgumentElement& rhs);
-    ArgumentElement(const char* arg__, const char* default__);
     ArgumentElement(const char* arg);
     ~ArgumentElement();
 
-    /**
-     * @brief Get the string argument
-     *
-     * @return std::string
-     */
-    std::string getString() const {
-        return argument_;
-    }
+    ArgumentElement& operator=(const ArgumentElement& rhs);
+
+#if __cplusplus >= 201103L
+    ArgumentElement(ArgumentElement&& rhs) noexcept;
+    ArgumentElement& operator=(ArgumentElement&& rhs) noexcept;
+#endif
 
     /**
-     * @brief Get the default value of argument
+     * @brief Get the string argument
      *
      * @return const std::string&
      */
-    const std::string& getDefault() const {
-        return default_;
+    const std::string& getString() const {
+        return argument_;
     }
 
     /**
-     * @brief Check if argument is number
+     * @brief Check if argument is a decimal number (the whole string), the string is converted at each call
      *
      * @return [true] if is number
      */
-    bool isNumber() const {
-        return isNumber_;
-    }
+    bool isNumber() const;
 
     /**
-     * @brief Get the number from argument if is number
+     * @brief Get the number from argument if is number, the string is converted at each call
      *
      * @return double
      *
      * @throw Exception is not a number
      */
-    double getNumber() const {
-        if (isNumber_) {
-            return number_;
-        }
-        throw Exception("is not a number");
-    }
+    double getNumber() const;
 
     /**
      * @brief tranform to vector of string
@@ -313,20 +313,251 @@ class ArgumentElement : public std::vector<ArgumentElement> {
     }
 
   protected:
+    /**
+     * @brief Swap all members with rhs, the capacities of containers are kept
+     *
+     * @param rhs
+     */
+    void swap_(ArgumentElement& rhs);
+
+    /**
+     * @brief Get the bytes allocated by the values out of this object
+     *
+     * @return std::size_t
+     */
+    std::size_t memoryUsage_() const;
+
     std::string argument_;
-    std::string default_;
-    bool isNumber_;
-    double number_;
 };
 
-template<typename T>
-class ArgumentType;
+/**
+ * @brief Const iterator on the values of an argument, the values are not copied
+ */
+class ValueIterator {
+  public:
+    typedef std::forward_iterator_tag iterator_category;
+    typedef StringView value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef const StringView* pointer;
+    typedef StringView reference;
+
+    ValueIterator() :
+        element_(NULL),
+        index_(0),
+        subIndex_(0),
+        isSingle_(false) {}
 
-template<typename T>
-class ArgumentVectorType;
+    /**
+     * @brief Construct a new Value Iterator object
+     *
+     * @param element parent of values
+     * @param index position in parent
+     * @param isSingle [true] if the value is the string of parent
+     */
+    ValueIterator(const ArgumentElement* element, std::size_t index, bool isSingle) :
+        element_(element),
+        index_(index),
+        subIndex_(0),
+        isSingle_(isSingle) {}
+
+    StringView operator*() const {
+        if (isSingle_) {
+            return StringView(element_->argument_);
+        }
+        const ArgumentElement& child = (*element_)[index_];
+        if (child.empty()) {
+            return StringView(child.argument_);
+        }
+        return StringView(child[subIndex_].argument_);
+    }
 
-template<typename T>
-class ArgumentVectorVectorType;
+    ValueIterator& operator++() {
+        if (isSingle_) {
+            ++index_;
+            return *this;
+        }
+        const ArgumentElement& child = (*element_)[index_];
+        if (!child.empty() && subIndex_ + 1 < child.size()) {
+            ++subIndex_;
+        }
+        else {
+            ++index_;
+            subIndex_ = 0;
+        }
+        return *this;
+    }
+
+    ValueIterator operator++(int) {
+        ValueIterator tmp(*this);
+        ++(*this);
+        return tmp;
+    }
+
+    friend bool operator==(const ValueIterator& lhs, const ValueIterator& rhs) {
+        return lhs.element_ == rhs.element_ && lhs.index_ == rhs.index_ && lhs.subIndex_ == rhs.subIndex_;
+    }
+
+    friend bool operator!=(const ValueIterator& lhs, const ValueIterator& rhs) {
+        return !(lhs == rhs);
+    }
+
+  private:
+    const ArgumentElement* element_;
+    std::size_t index_;
+    std::size_t subIndex_;
+    bool isSingle_;
+};
+
+/**
+ * @brief Range of values of an argument or of a group of argument
+ */
+class ValueRange
+#if __cplusplus >= 202002L
+    : public std::ranges::view_interface<ValueRange>
+#endif
+{
+  public:
+    typedef ValueIterator iterator;
+    typedef ValueIterator const_iterator;
+
+    ValueRange() :
+        begin_(),
+        end_() {}
+    ValueRange(const ValueIterator& begin, const ValueIterator& end) :
+        begin_(begin),
+        end_(end) {}
+
+    ValueIterator begin() const {
+        return begin_;
+    }
+
+    ValueIterator end() const {
+        return end_;
+    }
+
+  private:
+    ValueIterator begin_;
+    ValueIterator end_;
+};
+
+/**
+ * @brief Const iterator on the groups of values of a number argument
+ */
+class GroupIterator {
+  public:
+    typedef std::forward_iterator_tag iterator_category;
+    typedef ValueRange value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef const ValueRange* pointer;
+    typedef ValueRange reference;
+
+    GroupIterator() :
+        element_(NULL),
+        index_(0) {}
+    GroupIterator(const ArgumentElement* element, std::size_t index) :
+        element_(element),
+        index_(index) {}
+
+    ValueRange operator*() const {
+        const ArgumentElement* group = &((*element_)[index_]);
+        return ValueRange(ValueIterator(group, 0, false), ValueIterator(group, group->size(), false));
+    }
+
+    GroupIterator& operator++() {
+        ++index_;
+        return *this;
+    }
+
+    GroupIterator operator++(int) {
+        GroupIterator tmp(*this);
+        ++index_;
+        return tmp;
+    }
+
+    friend bool operator==(const GroupIterator& lhs, const GroupIterator& rhs) {
+        return lhs.element_ == rhs.element_ && lhs.index_ == rhs.index_;
+    }
+
+    friend bool operator!=(const GroupIterator& lhs, const GroupIterator& rhs) {
+        return !(lhs == rhs);
+    }
+
+  private:
+    const ArgumentElement* element_;
+    std::size_t index_;
+};
+
+/**
+ * @brief Range of groups of a number argument
+ */
+class GroupRange
+#if __cplusplus >= 202002L
+    : public std::ranges::view_interface<GroupRange>
+#endif
+{
+  public:
+    typedef GroupIterator iterator;
+    typedef GroupIterator const_iterator;
+
+    GroupRange() :
+        begin_(),
+        end_() {}
+    GroupRange(const GroupIterator& begin, const GroupIterator& end) :
+        begin_(begin),
+        end_(end) {}
+
+    GroupIterator begin() const {
+        return begin_;
+    }
+
+    GroupIterator end() const {
+        return end_;
+    }
+
+  private:
+    GroupIterator begin_;
+    GroupIterator end_;
+};
+
+/**
+ * @brief Lightweight reference of an argument, the access by args is O(1) without string.
+ *        A handle is invalid after the clear of its args or the remove of its argument,
+ *        the generation of index distinguishes the argument which reuses the index of a removed argument.
+ */
+class Handle {
+    friend class Args;
+
+  public:
+    Handle() :
+        args_(NULL),
+        index_(static_cast<std::size_t>(-1)),
+        generation_(0) {}
+
+    Handle(const Args& args, std::size_t index, unsigned int generation = 0) :
+        args_(&args),
+        index_(index),
+        generation_(generation) {}
+
+    std::size_t index() const {
+        return index_;
+    }
+
+    /**
+     * @brief Convert the values of argument to result like dest method
+     *
+     * @tparam T
+     * @param result
+     *
+     * @throw AccessDeniedException if the argument not exists
+     */
+    template<typename T>
+    void get(T& result) const;
+
+  private:
+    const Args* args_;
+    std::size_t index_;
+    unsigned int generation_;
+};
 
 /**
  * @brief Argument object
@@ -334,6 +565,8 @@ class ArgumentVectorVectorType;
 class Argument : public ArgumentElement {
     friend class Args;
     friend class Usage;
+    template<typename T>
+    friend struct ArgumentConverter;
 
   public:
     /**
@@ -348,10 +581,28 @@ class Argument : public ArgumentElement {
      */
     Argument(const Argument& rhs);
 
+#if __cplusplus >= 201103L
+    /**
+     * @brief Move a Argument object, the validator is owned by the new object
+     *
+     * @param rhs
+     */
+    Argument(Argument&& rhs) noexcept;
+#endif
+
     /**
      * @brief Destroy the Argument object
      */
-    virtual ~Argument();
+    ~Argument();
+
+    /**
+     * @brief Get the handle of argument for a O(1) access from args
+     *
+     * @return Handle
+     */
+    operator Handle() const {
+        return Handle(args_, index_, generation_);
+    }
 
     bool isExists() const {
         return isExist_;
@@ -369,12 +620,22 @@ class Argument : public ArgumentElement {
         return nargs_;
     }
 
-    const std::string& getHelp() const {
-        return help_;
-    }
+    /**
+     * @brief Get the help, a literal help is copied and a help function is called at each call
+     *
+     * @return const std::string&
+     */
+    const std::string& getHelp() const;
 
-    const std::string& getMetavar() const {
-        return metavar_;
+    /**
+     * @brief Get the metavar, a literal metavar is copied at first call
+     *
+     * @return const std::string&
+     */
+    const std::string& getMetavar() const;
+
+    const std::string& getGroup() const {
+        return group_;
     }
 
     const std::vector<std::string>& getNameOrFlags() const {
@@ -385,11 +646,25 @@ class Argument : public ArgumentElement {
         return defaults_;
     }
 
+    /**
+     * @brief Get the default values of argument in one string
+     *
+     * @return const std::string&
+     */
+    const std::string& getDefault() const {
+        return default_;
+    }
+
     Action::eAction getAction() const {
         return action_;
     }
 
-    std::string getString() const;
+    /**
+     * @brief Get the string of values, rendered once by parse
+     *
+     * @return const std::string&
+     */
+    const std::string& getString() const;
 
     /**
      * @brief Override bool operator
@@ -443,6 +718,24 @@ class Argument : public ArgumentElement {
         return getNumber();
     }
 
+    /**
+     * @brief Get the values without copy, same order than the vector of string operator
+     *
+     * @return ValueRange
+     *
+     * @throw Exception values not authorized
+     */
+    ValueRange values() const;
+
+    /**
+     * @brief Get the groups of values of number arguments without copy
+     *
+     * @return GroupRange
+     *
+     * @throw Exception groups not authorized
+     */
+    GroupRange groups() const;
+
     /**
      * @brief overide brakcet operator
      *
@@ -479,10 +772,15 @@ class Argument : public ArgumentElement {
      * @param help__
      * @return this reference
      */
-    Argument& help(const char* help__) {
-        help_ = help__;
-        return *this;
-    }
+    Argument& help(const char* help__);
+
+    /**
+     * @brief A function called to get the help of argument when the usage is rendered
+     *
+     * @param getHelp
+     * @return this reference
+     */
+    Argument& help(std::string (*getHelp)());
 
     /**
      * @brief Whether or not the command-line option may be omitted (optionals only)
@@ -498,10 +796,15 @@ class Argument : public ArgumentElement {
      * @param metavar__
      * @return this reference
      */
-    Argument& metavar(const char* metavar__) {
-        metavar_ = metavar__;
-        return *this;
-    }
+    Argument& metavar(const char* metavar__);
+
+    /**
+     * @brief A group name for select the argument in a filtered usage
+     *
+     * @param group__
+     * @return this reference
+     */
+    Argument& group(const char* group__);
 
     /**
      * @brief The number of command-line arguments that should be consumed
@@ -532,6 +835,22 @@ class Argument : public ArgumentElement {
         return *this;
     }
 
+#if __cplusplus >= 201103L
+    /**
+     * @brief The value produced if the argument is absent from the command line
+     *
+     * @param defaults__ moved in argument
+     * @return this reference
+     *
+     * @throw ArgumentException
+     */
+    Argument& defaults(Vector&& defaults__) {
+        defaults_ = std::move(defaults__);
+        defaultsConstructor_();
+        return *this;
+    }
+#endif
+
     /**
      * @brief New object from IValid interface
      *
@@ -548,23 +867,33 @@ class Argument : public ArgumentElement {
         return *this;
     }
 
+    /**
+     * @brief Read the values from a file descriptor by chunks when "-" is used as value of an infinite argument
+     *
+     * @param delimiter separator of values
+     * @param fd file descriptor (stdin by default)
+     * @return this reference
+     */
+    Argument& input(char delimiter = '\0', int fd = 0) {
+        inputDelimiter_ = delimiter;
+        inputFd_ = fd;
+        return *this;
+    }
+
     /**
      * @brief Define a reference of object for insert the value after parseArguments method
      *
      * @tparam T
      * @param dest
      * @param toDest
-     * @return reference of new argument
+     * @return this reference
      */
     template<typename T>
     Argument& dest(std::vector<std::vector<T> >& dest,
                    void (*toDest)(std::vector<std::vector<T> >& dest, bool isExists,
                                   const std::vector<std::vector<std::string> >& arguments) = NULL) {
-        bool validDeletable = validDeletable_;
-        validDeletable_ = false;
-        Argument* argumentType = new ArgumentVectorVectorType<T>(this, dest, toDest);
-        argumentType->validDeletable_ = validDeletable;
-        return *argumentType;
+        bindDest_(&dest, reinterpret_cast<void (*)()>(toDest), &toDestVectorVectorType_<T>, NULL);
+        return *this;
     }
 
     /**
@@ -573,16 +902,13 @@ class Argument : public ArgumentElement {
      * @tparam T
      * @param dest
      * @param toDest
-     * @return reference of new argument
+     * @return this reference
      */
     template<typename T>
     Argument& dest(std::vector<T>& dest, void (*toDest)(std::vector<T>& dest, bool isExists,
                                                         const std::vector<std::string>& arguments) = NULL) {
-        bool validDeletable = validDeletable_;
-        validDeletable_ = false;
-        Argument* argumentType = new ArgumentVectorType<T>(this, dest, toDest);
-        argumentType->validDeletable_ = validDeletable;
-        return *argumentType;
+        bindDest_(&dest, reinterpret_cast<void (*)()>(toDest), &toDestVectorType_<T>, NULL);
+        return *this;
     }
 
     /**
@@ -591,15 +917,27 @@ class Argument : public ArgumentElement {
      * @tparam T
      * @param dest
      * @param toDest
-     * @return reference of new argument
+     * @return this reference
      */
     template<typename T>
     Argument& dest(T& dest, void (*toDest)(T& dest, bool isExists, const std::string& argument) = NULL) {
-        bool validDeletable = validDeletable_;
-        validDeletable_ = false;
-        Argument* argumentType = new ArgumentType<T>(this, dest, toDest);
-        argumentType->validDeletable_ = validDeletable;
-        return *argumentType;
+        bindDest_(&dest, reinterpret_cast<void (*)()>(toDest), &toDestType_<T>, NULL);
+        return *this;
+    }
+
+    /**
+     * @brief Define a reference of object and a function called with each value during the parseArguments method.
+     *        The values of infinite and multi arguments are not kept by the argument.
+     *
+     * @tparam T
+     * @param dest
+     * @param toStream
+     * @return this reference
+     */
+    template<typename T>
+    Argument& dest(T& dest, void (*toStream)(T& dest, const char* argument)) {
+        bindDest_(&dest, reinterpret_cast<void (*)()>(toStream), &toDestStreamType_<T>, &toStreamType_<T>);
+        return *this;
     }
 
     /**
@@ -646,11 +984,63 @@ class Argument : public ArgumentElement {
         }
     }
 
-    virtual void toDest_() {
-        /* do nothing */
+    /**
+     * @brief Check if the values are given to the stream function during the parse
+     *
+     * @return [true] if values are not kept
+     */
+    bool isStreamed_() const {
+        if (!isStream_) {
+            return false;
+        }
+        switch (type_) {
+            case INFINITE_OPTION:
+            case MULTI_OPTION:
+            case MULTI_INFINITE_OPTION:
+            case INFINITE_POSITIONAL_ARGUMENT:
+                return true;
+            default:
+                return false;
+        }
     }
 
-    void toNumber_();
+    /**
+     * @brief Bind the destination record of argument
+     *
+     * @param dest address of destination object
+     * @param destCustom user function of dest or NULL
+     * @param destFunction typed function called after the parse
+     * @param streamFunction typed function called with each value during the parse or NULL
+     */
+    void bindDest_(void* dest, void (*destCustom)(), void (*destFunction)(const Argument&),
+                   void (*streamFunction)(const Argument&, const char*));
+
+    void toDest_() const {
+        if (destFunction_ != NULL) {
+            destFunction_(*this);
+        }
+    }
+
+    void toStream_(const char* argument) const {
+        if (streamFunction_ != NULL) {
+            streamFunction_(*this, argument);
+        }
+    }
+
+    template<typename T>
+    static void toDestType_(const Argument& argument);
+
+    template<typename T>
+    static void toDestVectorType_(const Argument& argument);
+
+    template<typename T>
+    static void toDestVectorVectorType_(const Argument& argument);
+
+    template<typename T>
+    static void toDestStreamType_(const Argument& argument);
+
+    template<typename T>
+    static void toStreamType_(const Argument& argument, const char* value);
 
     std::string metavarDefault_();
 
@@ -662,6 +1052,14 @@ class Argument : public ArgumentElement {
 
     void clear_();
 
+    void resetElements_();
+
+    std::size_t memoryUsage_() const;
+
+    bool hasDefault_() const;
+
+    void defaultTo_(std::string& str) const;
+
     static void validFormatFlag_(const char* flag);
 
     static bool compareOption_(const Argument* first, const Argument* second);
@@ -669,206 +1067,233 @@ class Argument : public ArgumentElement {
     Args& args_;
 
     std::vector<std::string> nameOrFlags_;
-    enum Type type_;
-    bool isExist_;
-    bool isRequired_;
+    std::vector<std::string> defaults_;
+    std::string default_;
     std::size_t count_;
     std::size_t nargs_;
-    std::string help_;
-    std::string metavar_;
+    std::size_t index_;
+    mutable std::string help_;
+    mutable std::string metavar_;
+    mutable const char* helpLiteral_;
+    mutable const char* metavarLiteral_;
+    std::string (*helpFunction_)();
+    std::string group_;
 
     IValid* valid_;
-    bool validDeletable_;
 
-    Argument** this_;
+    void* dest_;
+    void (*destCustom_)();
+    void (*destFunction_)(const Argument& argument);
+    void (*streamFunction_)(const Argument& argument, const char* value);
+
+    mutable std::string stringCache_;
+
+    // small members at the end for not pad each of them
+    enum Type type_;
     enum Action::eAction action_;
-    std::vector<std::string> defaults_;
+    int inputFd_;
+    unsigned int generation_;
+    char inputDelimiter_;
+    bool isExist_;
+    bool isRequired_;
+    bool validDeletable_;
+    bool isStream_;
+    mutable bool hasStringCache_;
 };
 
+/**
+ * @brief Convert the values of argument to a destination object
+ *
+ * @tparam T type of destination
+ */
 template<typename T>
-class ArgumentType : public Argument {
-  public:
-    ArgumentType(Argument* argument, T& dest, void (*toDest)(T&, bool, const std::string&)) :
-        Argument(*argument),
-        dest_(dest),
-        toDestCustom_(toDest) {
-        delete argument;
-        *this_ = this;
-    }
-    virtual ~ArgumentType() {}
-
-  private:
-    void toDest_() {
-        if (toDestCustom_ != NULL) {
-            toDestCustom_(dest_, isExist_, argument_);
+struct ArgumentConverter {
+    static void to(const Argument& argument, T& dest) {
+        if (argument.type_ == Argument::BOOLEAN_OPTION) {
+            boolTo(argument.isExist_, dest);
+        }
+        else if (argument.type_ == Argument::REVERSE_BOOLEAN_OPTION) {
+            boolTo(!argument.isExist_, dest);
         }
         else {
-            if (type_ == BOOLEAN_OPTION) {
-                boolTo(isExist_, dest_);
-            }
-            else if (type_ == REVERSE_BOOLEAN_OPTION) {
-                boolTo(!isExist_, dest_);
-            }
-            else {
-                strTo(argument_, dest_);
-            }
+            strTo(argument.argument_, dest);
         }
     }
-
-    T& dest_;
-    void (*toDestCustom_)(T&, bool, const std::string&);
 };
 
+/**
+ * @brief Convert the values of argument to a vector
+ *
+ * @tparam T type of vector element
+ */
 template<typename T>
-class ArgumentVectorType : public Argument {
-  public:
-    ArgumentVectorType(Argument* argument, std::vector<T>& dest,
-                       void (*toDest)(std::vector<T>&, bool, const std::vector<std::string>&)) :
-        Argument(*argument),
-        dest_(dest),
-        toDestCustom_(toDest) {
-        delete argument;
-        *this_ = this;
-    }
-    virtual ~ArgumentVectorType() {}
-
-  private:
-    void toDest_() {
-        if (toDestCustom_ != NULL) {
-            std::vector<std::string> arguments;
-            if (!empty()) {
-                for (std::size_t i = 0; i < size(); ++i) {
-                    if (!at(i).empty()) {
-                        for (std::size_t j = 0; j < at(i).size(); ++j) {
-                            arguments.push_back(at(i).at(j).getString());
-                        }
-                    }
-                    else {
-                        arguments.push_back(at(i).getString());
+struct ArgumentConverter<std::vector<T> > {
+    static void to(const Argument& argument, std::vector<T>& dest) {
+        if (!argument.empty()) {
+            for (std::size_t i = 0; i < argument.size(); ++i) {
+                if (!argument.at(i).empty()) {
+                    for (std::size_t j = 0; j < argument.at(i).size(); ++j) {
+                        T value;
+                        strTo(argument.at(i).at(j).getString(), value);
+                        dest.push_back(value);
                     }
                 }
+                else {
+                    T value;
+                    strTo(argument.at(i).getString(), value);
+                    dest.push_back(value);
+                }
             }
-            else {
-                arguments.push_back(argument_);
-            }
-            toDestCustom_(dest_, isExist_, arguments);
         }
         else {
-            if (!empty()) {
-                for (std::size_t i = 0; i < size(); ++i) {
-                    if (!at(i).empty()) {
-                        for (std::size_t j = 0; j < at(i).size(); ++j) {
-                            T dest;
-                            strTo(at(i).at(j).getString(), dest);
-                            dest_.push_back(dest);
-                        }
-                    }
-                    else {
-                        T dest;
-                        strTo(at(i).getString(), dest);
-                        dest_.push_back(dest);
+            T value;
+            ArgumentConverter<T>::to(argument, value);
+            dest.push_back(value);
+        }
+    }
+};
+
+/**
+ * @brief Convert the values of argument to a vector of vector
+ *
+ * @tparam T type of vector element
+ */
+template<typename T>
+struct ArgumentConverter<std::vector<std::vector<T> > > {
+    static void to(const Argument& argument, std::vector<std::vector<T> >& dest) {
+        if (!argument.empty()) {
+            dest.reserve(dest.size() + argument.size());
+            for (std::size_t i = 0; i < argument.size(); ++i) {
+                // construct in place for not copy the vector
+                dest.push_back(std::vector<T>());
+                std::vector<T>& vectorDest = dest.back();
+                if (!argument.at(i).empty()) {
+                    vectorDest.reserve(argument.at(i).size());
+                    for (std::size_t j = 0; j < argument.at(i).size(); ++j) {
+                        T value;
+                        strTo(argument.at(i).at(j).getString(), value);
+                        vectorDest.push_back(value);
                     }
                 }
-            }
-            else {
-                T dest;
-                if (type_ == BOOLEAN_OPTION) {
-                    boolTo(isExist_, dest);
-                }
-                else if (type_ == REVERSE_BOOLEAN_OPTION) {
-                    boolTo(!isExist_, dest);
-                }
                 else {
-                    strTo(argument_, dest);
+                    T value;
+                    strTo(argument.at(i).getString(), value);
+                    vectorDest.push_back(value);
                 }
-                dest_.push_back(dest);
             }
         }
+        else {
+            T value;
+            ArgumentConverter<T>::to(argument, value);
+            dest.push_back(std::vector<T>(1, value));
+        }
     }
-
-    std::vector<T>& dest_;
-    void (*toDestCustom_)(std::vector<T>&, bool, const std::vector<std::string>&);
 };
 
 template<typename T>
-class ArgumentVectorVectorType : public Argument {
-  public:
-    ArgumentVectorVectorType(Argument* argument, std::vector<std::vector<T> >& dest,
-                             void (*toDest)(std::vector<std::vector<T> >&, bool,
-                                            const std::vector<std::vector<std::string> >&)) :
-        Argument(*argument),
-        dest_(dest),
-        toDestCustom_(toDest) {
-        delete argument;
-        *this_ = this;
+void Argument::toDestType_(const Argument& argument) {
+    T& dest = *static_cast<T*>(argument.dest_);
+    if (argument.destCustom_ != NULL) {
+        reinterpret_cast<void (*)(T&, bool, const std::string&)>(argument.destCustom_)(dest, argument.isExist_,
+                                                                                       argument.argument_);
+    }
+    else {
+        ArgumentConverter<T>::to(argument, dest);
     }
-    virtual ~ArgumentVectorVectorType() {}
+}
 
-  private:
-    void toDest_() {
-        if (toDestCustom_ != NULL) {
-            std::vector<std::vector<std::string> > arguments;
-            if (!empty()) {
-                for (std::size_t i = 0; i < size(); ++i) {
-                    std::vector<std::string> tmpVector;
-                    if (!at(i).empty()) {
-                        for (std::size_t j = 0; j < at(i).size(); ++j) {
-                            tmpVector.push_back(at(i).at(j).getString());
-                        }
-                    }
-                    else {
-                        tmpVector.push_back(at(i).getString());
+template<typename T>
+void Argument::toDestVectorType_(const Argument& argument) {
+    std::vector<T>& dest = *static_cast<std::vector<T>*>(argument.dest_);
+    if (argument.destCustom_ != NULL) {
+        std::vector<std::string> arguments;
+        if (!argument.empty()) {
+            for (std::size_t i = 0; i < argument.size(); ++i) {
+                if (!argument.at(i).empty()) {
+                    for (std::size_t j = 0; j < argument.at(i).size(); ++j) {
+                        arguments.push_back(argument.at(i).at(j).getString());
                     }
-                    arguments.push_back(tmpVector);
+                }
+                else {
+                    arguments.push_back(argument.at(i).getString());
                 }
             }
-            else {
+        }
+        else {
+            arguments.push_back(argument.argument_);
+        }
+        reinterpret_cast<void (*)(std::vector<T>&, bool, const std::vector<std::string>&)>(argument.destCustom_)(
+            dest, argument.isExist_, arguments);
+    }
+    else {
+        ArgumentConverter<std::vector<T> >::to(argument, dest);
+    }
+}
+
+template<typename T>
+void Argument::toDestVectorVectorType_(const Argument& argument) {
+    std::vector<std::vector<T> >& dest = *static_cast<std::vector<std::vector<T> >*>(argument.dest_);
+    if (argument.destCustom_ != NULL) {
+        std::vector<std::vector<std::string> > arguments;
+        if (!argument.empty()) {
+            for (std::size_t i = 0; i < argument.size(); ++i) {
                 std::vector<std::string> tmpVector;
-                tmpVector.push_back(argument_);
+                if (!argument.at(i).empty()) {
+                    for (std::size_t j = 0; j < argument.at(i).size(); ++j) {
+                        tmpVector.push_back(argument.at(i).at(j).getString());
+                    }
+                }
+                else {
+                    tmpVector.push_back(argument.at(i).getString());
+                }
                 arguments.push_back(tmpVector);
             }
-            toDestCustom_(dest_, isExist_, arguments);
         }
         else {
-            if (!empty()) {
-                for (std::size_t i = 0; i < size(); ++i) {
-                    std::vector<T> vectorDest;
-                    if (!at(i).empty()) {
-                        for (std::size_t j = 0; j < at(i).size(); ++j) {
-                            T dest;
-                            strTo(at(i).at(j).getString(), dest);
-                            vectorDest.push_back(dest);
-                        }
-                    }
-                    else {
-                        T dest;
-                        strTo(at(i).getString(), dest);
-                        vectorDest.push_back(dest);
-                    }
-                    dest_.push_back(vectorDest);
+            std::vector<std::string> tmpVector;
+            tmpVector.push_back(argument.argument_);
+            arguments.push_back(tmpVector);
+        }
+        reinterpret_cast<void (*)(std::vector<std::vector<T> >&, bool,
+                                  const std::vector<std::vector<std::string> >&)>(argument.destCustom_)(
+            dest, argument.isExist_, arguments);
+    }
+    else {
+        ArgumentConverter<std::vector<std::vector<T> > >::to(argument, dest);
+    }
+}
+
+template<typename T>
+void Argument::toStreamType_(const Argument& argument, const char* value) {
+    reinterpret_cast<void (*)(T&, const char*)>(argument.destCustom_)(*static_cast<T*>(argument.dest_), value);
+}
+
+template<typename T>
+void Argument::toDestStreamType_(const Argument& argument) {
+    // already streamed during the parse
+    if (argument.isExist_ && argument.isStreamed_()) {
+        return;
+    }
+    if (argument.type_ == BOOLEAN_OPTION || argument.type_ == REVERSE_BOOLEAN_OPTION ||
+        argument.type_ == HELP_OPTION || argument.type_ == VERSION_OPTION) {
+        return;
+    }
+    if (!argument.empty()) {
+        for (std::size_t i = 0; i < argument.size(); ++i) {
+            if (!argument.at(i).empty()) {
+                for (std::size_t j = 0; j < argument.at(i).size(); ++j) {
+                    toStreamType_<T>(argument, argument.at(i).at(j).getString().c_str());
                 }
             }
             else {
-                T dest;
-                if (type_ == BOOLEAN_OPTION) {
-                    boolTo(isExist_, dest);
-                }
-                else if (type_ == REVERSE_BOOLEAN_OPTION) {
-                    boolTo(!isExist_, dest);
-                }
-                else {
-                    strTo(argument_, dest);
-                }
-                std::vector<T> vectorDest;
-                vectorDest.push_back(dest);
-                dest_.push_back(vectorDest);
+                toStreamType_<T>(argument, argument.at(i).getString().c_str());
             }
         }
     }
-
-    std::vector<std::vector<T> >& dest_;
-    void (*toDestCustom_)(std::vector<std::vector<T> >&, bool, const std::vector<std::vector<std::string> >&);
-};
+    else if (argument.isExist_ || argument.hasDefault_()) {
+        toStreamType_<T>(argument, argument.argument_.c_str());
+    }
+}
 
 } // namespace args
 
@@ -0,0 +1,187 @@
+/**
+ * args/constraint.h
+ *
+ * Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+ * Copyright (c) 2022-2023 BLET Mickael.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef BLET_ARGS_CONSTRAINT_H_
+#define BLET_ARGS_CONSTRAINT_H_
+
+#include <climits> // CHAR_BIT
+#include <cstddef>
+#include <vector>
+
+namespace blet {
+
+namespace args {
+
+/**
+ * @brief Constraint between arguments compiled in a mask of bits by index of argument.
+ *        The mask only keeps the words between the first and the last argument of constraint.
+ */
+class Constraint {
+  public:
+    enum eType {
+        EXCLUSIVE, // at most one argument of mask exists
+        REQUIRES,  // all arguments of mask exist if the source exists
+        CONFLICTS  // no argument of mask exists if the source exists
+    };
+
+    static const std::size_t BITS_PER_WORD = sizeof(unsigned long) * CHAR_BIT;
+    static const std::size_t npos = static_cast<std::size_t>(-1);
+
+    /**
+     * @brief Construct a new empty Constraint object
+     *
+     * @param type
+     * @param source index of the source argument of REQUIRES and CONFLICTS
+     * @param isRequired one argument of EXCLUSIVE is required
+     */
+    Constraint(enum eType type, std::size_t source, bool isRequired) :
+        type_(type),
+        source_(source),
+        isRequired_(isRequired),
+        firstWord_(0),
+        mask_() {}
+
+    enum eType getType() const {
+        return type_;
+    }
+
+    std::size_t getSource() const {
+        return source_;
+    }
+
+    bool isRequired() const {
+        return isRequired_;
+    }
+
+    /**
+     * @brief Add the argument of index in mask
+     *
+     * @param index
+     */
+    void set(std::size_t index) {
+        std::size_t word = index / BITS_PER_WORD;
+        if (mask_.empty()) {
+            firstWord_ = word;
+        }
+        else if (word < firstWord_) {
+            mask_.insert(mask_.begin(), firstWord_ - word, 0UL);
+            firstWord_ = word;
+        }
+        if (word - firstWord_ >= mask_.size()) {
+            mask_.resize(word - firstWord_ + 1, 0UL);
+        }
+        mask_[word - firstWord_] |= 1UL << (index % BITS_PER_WORD);
+    }
+
+    /**
+     * @brief Remove the argument of index from mask
+     *
+     * @param index
+     */
+    void reset(std::size_t index) {
+        std::size_t word = index / BITS_PER_WORD;
+        if (word >= firstWord_ && word - firstWord_ < mask_.size()) {
+            mask_[word - firstWord_] &= ~(1UL << (index % BITS_PER_WORD));
+        }
+    }
+
+    /**
+     * @brief Count the arguments of mask in bits, the count stops at 2
+     *
+     * @param bits
+     * @return std::size_t 0, 1 or 2 for two and more
+     */
+    std::size_t count(const std::vector<unsigned long>& bits) const {
+        std::size_t ret = 0;
+        for (std::size_t i = 0; i < mask_.size() && firstWord_ + i < bits.size(); ++i) {
+            unsigned long word = mask_[i] & bits[firstWord_ + i];
+            if (word != 0) {
+                // more than one bit in word
+                if (ret > 0 || (word & (word - 1)) != 0) {
+                    return 2;
+                }
+                ret = 1;
+            }
+        }
+        return ret;
+    }
+
+    /**
+     * @brief Check if all the arguments of mask are in bits
+     *
+     * @param bits
+     * @return [true] if mask is in bits
+     */
+    bool isIn(const std::vector<unsigned long>& bits) const {
+        for (std::size_t i = 0; i < mask_.size(); ++i) {
+            unsigned long word = (firstWord_ + i < bits.size()) ? bits[firstWord_ + i] : 0UL;
+            if ((mask_[i] & ~word) != 0) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Get the first index of argument of mask from index
+     *
+     * @param index
+     * @return std::size_t index or npos
+     */
+    std::size_t next(std::size_t index) const {
+        std::size_t end = (firstWord_ + mask_.size()) * BITS_PER_WORD;
+        if (index < firstWord_ * BITS_PER_WORD) {
+            index = firstWord_ * BITS_PER_WORD;
+        }
+        for (; index < end; ++index) {
+            if ((mask_[index / BITS_PER_WORD - firstWord_] >> (index % BITS_PER_WORD)) & 1UL) {
+                return index;
+            }
+        }
+        return npos;
+    }
+
+    /**
+     * @brief Get the bytes allocated by the mask out of this object
+     *
+     * @return std::size_t
+     */
+    std::size_t memoryUsage() const {
+        return mask_.capacity() * sizeof(unsigned long);
+    }
+
+  private:
+    enum eType type_;
+    std::size_t source_;
+    bool isRequired_;
+    std::size_t firstWord_;
+    std::vector<unsigned long> mask_;
+};
+
+} // namespace args
+
+} // namespace blet
+
+#endif // #ifndef BLET_ARGS_CONSTRAINT_H_
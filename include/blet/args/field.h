@@ -0,0 +1,83 @@
+/**
+ * args/field.h
+ *
+ * Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+ * Copyright (c) 2022-2023 BLET Mickael.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef BLET_ARGS_FIELD_H_
+#define BLET_ARGS_FIELD_H_
+
+#include <cstddef> // offsetof
+
+#include "blet/args/argument.h"
+
+namespace blet {
+
+namespace args {
+
+/**
+ * @brief Descriptor of a field of struct filled by parseArguments
+ */
+struct Field {
+    const char* nameOrFlag;
+    std::size_t offset;
+    void (*toField)(const Argument& argument, void* field);
+};
+
+/**
+ * @brief Convert the values of argument to the field
+ *
+ * @tparam T type of field
+ * @param argument
+ * @param field address of field
+ */
+template<typename T>
+inline void fieldTo(const Argument& argument, void* field) {
+    ArgumentConverter<T>::to(argument, *static_cast<T*>(field));
+}
+
+/**
+ * @brief Create a descriptor of field, prefer the ARGS_FIELD macro
+ *
+ * @tparam S type of struct
+ * @tparam T type of field
+ * @param nameOrFlag name or flag of argument
+ * @param offset offset of field in struct
+ * @return Field
+ */
+template<typename S, typename T>
+inline Field makeField(const char* nameOrFlag, std::size_t offset, T S::*) {
+    Field field = {nameOrFlag, offset, &fieldTo<T>};
+    return field;
+}
+
+} // namespace args
+
+} // namespace blet
+
+/**
+ * @brief Create a descriptor of the member of a standard layout struct filled from the argument nameOrFlag
+ */
+#define ARGS_FIELD(Struct, member, nameOrFlag) \
+    ::blet::args::makeField(nameOrFlag, offsetof(Struct, member), &Struct::member)
+
+#endif // #ifndef BLET_ARGS_FIELD_H_
@@ -0,0 +1,89 @@
+/**
+ * args/input.h
+ *
+ * Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+ * Copyright (c) 2022-2023 BLET Mickael.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef BLET_ARGS_INPUT_H_
+#define BLET_ARGS_INPUT_H_
+
+#include <cstddef>
+
+namespace blet {
+
+namespace args {
+
+/**
+ * @brief Read delimited values from a file descriptor by large chunks
+ */
+class InputReader {
+  public:
+    /**
+     * @brief Construct a new Input Reader object
+     *
+     * @param fd file descriptor to read
+     * @param delimiter separator of values
+     * @param chunkSize size of one read
+     */
+    InputReader(int fd, char delimiter, std::size_t chunkSize = 65536);
+
+    /**
+     * @brief Destroy the Input Reader object
+     */
+    ~InputReader();
+
+    /**
+     * @brief Get the next value, the empty values are ignored.
+     *        The value is valid until the next call.
+     *
+     * @return const char* next value or NULL at end of input
+     *
+     * @throw ParseArgumentException
+     */
+    const char* next();
+
+  private:
+    InputReader(const InputReader&);            // disable copy constructor
+    InputReader& operator=(const InputReader&); // disable copy operator
+
+    /**
+     * @brief Move the unused part at the begin of buffer and read the next chunk
+     *
+     * @return [false] at end of input
+     */
+    bool fill_();
+
+    int fd_;
+    char delimiter_;
+    std::size_t chunkSize_;
+    char* buffer_;
+    std::size_t capacity_;
+    std::size_t begin_;
+    std::size_t end_;
+    bool isEnd_;
+};
+
+} // namespace args
+
+} // namespace blet
+
+#endif // #ifndef BLET_ARGS_INPUT_H_
@@ -0,0 +1,227 @@
+/**
+ * args/response.h
+ *
+ * Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+ * Copyright (c) 2022-2023 BLET Mickael.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef BLET_ARGS_RESPONSE_H_
+#define BLET_ARGS_RESPONSE_H_
+
+#include <string>
+#include <vector>
+
+namespace blet {
+
+namespace args {
+
+/**
+ * @brief Expand the "@path" arguments with the content of response files.
+ *        Each file is memory-mapped read-only and counted at the expansion, then its tokens are read on demand by
+ *        the parser in a ring of reused buffers: the extra memory does not depend of the size of files.
+ */
+class ResponseFile {
+  public:
+    enum eMode {
+        NONE = 0,
+        NEWLINE,
+        NUL,
+        SHELL
+    };
+
+    /**
+     * @brief Construct a new Response File object
+     *
+     * @param mode tokenization of the files
+     */
+    ResponseFile(enum eMode mode);
+
+    /**
+     * @brief Destroy the Response File object and unmap all files
+     */
+    ~ResponseFile();
+
+    /**
+     * @brief Expand each "@path" argument before the "--" argument
+     *
+     * @param argc
+     * @param argv
+     * @return [true] if at least one argument is expanded
+     *
+     * @throw ParseArgumentException
+     */
+    bool expand(int argc, char* argv[]);
+
+    /**
+     * @brief Get the number of expanded arguments
+     *
+     * @return int
+     */
+    int argc() const {
+        return argc_;
+    }
+
+    /**
+     * @brief Get the expanded argument at index.
+     *        A token of file is read from the mapping and stays valid until the next tokens of files are read.
+     *
+     * @param index
+     * @return const char*
+     */
+    const char* token(int index);
+
+    /**
+     * @brief Get the index of the first "--" argument from index or argc
+     *
+     * @param index
+     * @return int
+     */
+    int endOptionIndex(int index);
+
+    /**
+     * @brief Get the bytes allocated by this object without the mappings of files
+     *
+     * @return std::size_t
+     */
+    std::size_t memoryUsage() const;
+
+  private:
+    ResponseFile(const ResponseFile&);            // disable copy constructor
+    ResponseFile& operator=(const ResponseFile&); // disable copy operator
+
+    /**
+     * @brief Consecutive arguments of argv or tokens of a file
+     */
+    struct Segment {
+        char** argv;          // arguments of argv or NULL
+        const char* argument; // "@path" argument
+        const char* begin;    // mapping of file
+        const char* end;
+        int index;            // index of first argument
+    };
+
+    /**
+     * @brief Compare the index with the first index of segment
+     *
+     * @param index
+     * @param segment
+     * @return true if index is before segment
+     */
+    static bool compareIndex_(int index, const Segment& segment) {
+        return index < segment.index;
+    }
+
+    /**
+     * @brief Map the file and count its tokens
+     *
+     * @param argument "@path" argument
+     *
+     * @throw ParseArgumentException
+     */
+    void map_(const char* argument);
+
+    /**
+     * @brief Push the arguments of argv in a segment
+     *
+     * @param argv
+     * @param count number of arguments
+     */
+    void pushArguments_(char** argv, int count);
+
+    /**
+     * @brief Read the next token of file from position
+     *
+     * @param argument "@path" argument
+     * @param position [in,out] position in mapping
+     * @param end end of mapping
+     * @param buffer buffer of token if it is not terminated in the mapping
+     * @return const char* token or NULL at the end of mapping
+     *
+     * @throw ParseArgumentException
+     */
+    const char* readToken_(const char* argument, const char** position, const char* end, std::string* buffer) const;
+
+    enum eMode mode_;
+    int argc_;
+    int endOptionIndex_;
+    std::vector<Segment> segments_;
+    // cursor of the file segment read on demand
+    std::size_t segment_;
+    const char* position_;
+    const char* released_;
+    int next_;
+    // last tokens read by index modulo ring size
+    std::vector<const char*> tokens_;
+    std::vector<std::string> buffers_;
+};
+
+/**
+ * @brief Arguments given to the parser: the argv of command line or the expanded arguments of a response file
+ */
+class Tokens {
+  public:
+    Tokens(char* argv[]) :
+        argv_(argv),
+        responseFile_(NULL),
+        offset_(0) {}
+
+    Tokens(ResponseFile& responseFile) :
+        argv_(NULL),
+        responseFile_(&responseFile),
+        offset_(0) {}
+
+    /**
+     * @brief Construct the arguments from offset of tokens (e.g. arguments of subcommand)
+     *
+     * @param tokens
+     * @param offset
+     */
+    Tokens(const Tokens& tokens, int offset) :
+        argv_(tokens.argv_),
+        responseFile_(tokens.responseFile_),
+        offset_(tokens.offset_ + offset) {}
+
+    const char* operator[](int index) const {
+        if (responseFile_ == NULL) {
+            return argv_[offset_ + index];
+        }
+        return responseFile_->token(offset_ + index);
+    }
+
+    /**
+     * @brief Get the index of "--" argument or argc
+     *
+     * @param argc
+     * @return int
+     */
+    int endOptionIndex(int argc) const;
+
+  private:
+    char** argv_;
+    ResponseFile* responseFile_;
+    int offset_;
+};
+
+} // namespace args
+
+} // namespace blet
+
+#endif // #ifndef BLET_ARGS_RESPONSE_H_
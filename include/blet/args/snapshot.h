@@ -0,0 +1,183 @@
+/**
+ * args/snapshot.h
+ *
+ * Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+ * Copyright (c) 2022-2023 BLET Mickael.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef BLET_ARGS_SNAPSHOT_H_
+#define BLET_ARGS_SNAPSHOT_H_
+
+#include <cstddef>
+
+namespace blet {
+
+namespace args {
+
+/**
+ * @brief Memory-mapped binary snapshot of arguments.
+ *        All the references of snapshot are offsets from the begin of file,
+ *        the strings are used in place from the mapping.
+ */
+class Snapshot {
+  public:
+    typedef unsigned int Offset;
+
+    static const Offset VERSION = 1;
+    static const Offset ENDIAN = 0x01020304;
+    // a corrupted nargs can't repeat a metavar billions of times in usage
+    static const Offset MAX_NARGS = 0xFFFF;
+
+    struct Header {
+        char magic[8]; // "BLETARGS"
+        Offset version;
+        Offset endian;
+        Offset size;
+        Offset description;
+        Offset epilog;
+        Offset usage;
+        Offset versionMessage;
+        Offset argumentCount;
+        Offset arguments;
+        Offset slotCount;
+        Offset slots;
+        Offset displacementCount;
+        Offset displacements;
+        Offset shortOptions; // 128 entries of index + 1 of argument, 0 if not exists
+    };
+
+    struct Argument {
+        Offset nameOrFlags; // array of string offsets
+        Offset flagCount;
+        Offset action;
+        Offset nargs;
+        Offset defaults; // array of string offsets
+        Offset defaultCount;
+        Offset help;
+        Offset metavar;
+        Offset isRequired;
+    };
+
+    struct Slot {
+        Offset nameOrFlag;
+        Offset argument;
+    };
+
+    /**
+     * @brief Construct a new Snapshot object
+     */
+    Snapshot();
+
+    /**
+     * @brief Destroy the Snapshot object and unmap the file
+     */
+    ~Snapshot();
+
+    /**
+     * @brief Map a snapshot file and check its header, offsets, counts and indexes
+     *
+     * @param filename
+     *
+     * @throw Exception
+     */
+    void map(const char* filename);
+
+    const Header& header() const {
+        return *reinterpret_cast<const Header*>(data_);
+    }
+
+    /**
+     * @brief Get a string from its offset
+     *
+     * @param offset
+     * @return const char* or NULL if offset is 0
+     */
+    const char* string(Offset offset) const {
+        return offset == 0 ? NULL : data_ + offset;
+    }
+
+    /**
+     * @brief Get a array of offsets from its offset
+     *
+     * @param offset
+     * @return const Offset*
+     */
+    const Offset* offsets(Offset offset) const {
+        return reinterpret_cast<const Offset*>(data_ + offset);
+    }
+
+    const Argument& argument(std::size_t index) const {
+        return reinterpret_cast<const Argument*>(data_ + header().arguments)[index];
+    }
+
+    /**
+     * @brief Find the index of argument from its name or flag with the perfect hash of snapshot
+     *
+     * @param str
+     * @param size
+     * @return index of argument or -1 if not found
+     */
+    std::size_t find(const char* str, std::size_t size) const;
+
+    /**
+     * @brief Find the index of argument from its short option
+     *
+     * @param option
+     * @return index of argument or -1 if not found
+     */
+    std::size_t findShort(char option) const {
+        if (static_cast<unsigned char>(option) >= 128) {
+            return static_cast<std::size_t>(-1);
+        }
+        return static_cast<std::size_t>(offsets(header().shortOptions)[static_cast<unsigned char>(option)]) - 1;
+    }
+
+  private:
+    Snapshot(const Snapshot&);            // disable copy constructor
+    Snapshot& operator=(const Snapshot&); // disable copy operator
+
+    /**
+     * @brief Check if a array is aligned and in the mapping
+     *
+     * @param offset
+     * @param count number of elements
+     * @param elementSize
+     * @return [true] if array is valid
+     */
+    bool isArray_(Offset offset, std::size_t count, std::size_t elementSize) const;
+
+    /**
+     * @brief Check if a string is in the mapping, the last '\0' of mapping ends it
+     *
+     * @param offset
+     * @return [true] if string is valid
+     */
+    bool isString_(Offset offset) const;
+
+    const char* data_;
+    std::size_t size_;
+};
+
+} // namespace args
+
+} // namespace blet
+
+#endif // #ifndef BLET_ARGS_SNAPSHOT_H_
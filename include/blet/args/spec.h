@@ -0,0 +1,372 @@
+/**
+ * args/spec.h
+ *
+ * Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+ * Copyright (c) 2022-2023 BLET Mickael.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef BLET_ARGS_SPEC_H_
+#define BLET_ARGS_SPEC_H_
+
+#if __cplusplus >= 201703L
+
+#include <cstddef>
+
+#include "blet/args/action.h"
+#include "blet/args/exception.h"
+
+namespace blet {
+
+namespace args {
+
+/**
+ * @brief Declaration of an argument usable in a constant expression.
+ *        The checks of addArgument, flag, action, nargs and defaults are done at the construction,
+ *        a malformed declaration in a constexpr context is a compile error.
+ */
+class OptionSpec {
+    template<std::size_t N>
+    friend class Spec;
+
+  public:
+    static constexpr std::size_t MAX_FLAGS = 8;
+    static constexpr std::size_t MAX_DEFAULTS = 16;
+
+    /**
+     * @brief Construct a new Option Spec object
+     *
+     * @param nameOrFlag Either a name or a option string, e.g. foo or -f
+     *
+     * @throw ArgumentException
+     */
+    constexpr OptionSpec(const char* nameOrFlag) :
+        nameOrFlags_(),
+        flagCount_(1),
+        action_(Action::NONE),
+        nargs_(1),
+        help_(nullptr),
+        metavar_(nullptr),
+        defaults_(),
+        defaultCount_(0),
+        isRequired_(false) {
+        if (nameOrFlag == nullptr || nameOrFlag[0] == '\0') {
+            throw ArgumentException("", "invalid empty flag");
+        }
+        if (nameOrFlag[0] == '-') {
+            validFormatFlag_(nameOrFlag);
+        }
+        nameOrFlags_[0] = nameOrFlag;
+        checkType_();
+    }
+
+    /**
+     * @brief Add a option string
+     *
+     * @param flag__
+     * @return new option spec
+     *
+     * @throw ArgumentException
+     */
+    constexpr OptionSpec flag(const char* flag__) const {
+        OptionSpec ret(*this);
+        if (ret.isPositionnal()) {
+            throw ArgumentException(nameOrFlags_[0], "invalid flag on positional argument");
+        }
+        validFormatFlag_(flag__);
+        for (std::size_t i = 0; i < flagCount_; ++i) {
+            if (isEqual_(nameOrFlags_[i], flag__)) {
+                throw ArgumentException(flag__, "invalid flag already exist");
+            }
+        }
+        if (flagCount_ >= MAX_FLAGS) {
+            throw ArgumentException(flag__, "too many flags");
+        }
+        ret.nameOrFlags_[ret.flagCount_++] = flag__;
+        return ret;
+    }
+
+    /**
+     * @brief The basic type of action to be taken when this argument is encountered at the command line
+     *
+     * @param action__
+     * @return new option spec
+     *
+     * @throw ArgumentException
+     */
+    constexpr OptionSpec action(enum Action::eAction action__) const {
+        OptionSpec ret(*this);
+        ret.action_ = action__;
+        ret.checkType_();
+        return ret;
+    }
+
+    /**
+     * @brief The number of command-line arguments that should be consumed
+     *
+     * @param nargs__
+     * @return new option spec
+     *
+     * @throw ArgumentException
+     */
+    constexpr OptionSpec nargs(std::size_t nargs__) const {
+        OptionSpec ret(*this);
+        ret.nargs_ = nargs__;
+        ret.checkType_();
+        return ret;
+    }
+
+    /**
+     * @brief The values produced if the argument is absent from the command line
+     *
+     * @param defaults__
+     * @return new option spec
+     *
+     * @throw ArgumentException
+     */
+    template<typename... T>
+    constexpr OptionSpec defaults(const T&... defaults__) const {
+        OptionSpec ret(*this);
+        const char* values[sizeof...(T) + 1] = {defaults__..., nullptr};
+        if (sizeof...(T) > MAX_DEFAULTS) {
+            throw ArgumentException(nameOrFlags_[0], "too many default arguments");
+        }
+        for (std::size_t i = 0; i < sizeof...(T); ++i) {
+            ret.defaults_[i] = values[i];
+        }
+        ret.defaultCount_ = sizeof...(T);
+        ret.checkType_();
+        return ret;
+    }
+
+    /**
+     * @brief A brief description of what the argument does
+     *
+     * @param help__
+     * @return new option spec
+     */
+    constexpr OptionSpec help(const char* help__) const {
+        OptionSpec ret(*this);
+        ret.help_ = help__;
+        return ret;
+    }
+
+    /**
+     * @brief A name for the argument in usage messages
+     *
+     * @param metavar__
+     * @return new option spec
+     */
+    constexpr OptionSpec metavar(const char* metavar__) const {
+        OptionSpec ret(*this);
+        ret.metavar_ = metavar__;
+        return ret;
+    }
+
+    /**
+     * @brief Whether or not the command-line option may be omitted
+     *
+     * @param required__
+     * @return new option spec
+     */
+    constexpr OptionSpec required(bool required__ = true) const {
+        OptionSpec ret(*this);
+        ret.isRequired_ = required__;
+        return ret;
+    }
+
+    constexpr bool isPositionnal() const {
+        return nameOrFlags_[0][0] != '-';
+    }
+    constexpr std::size_t flagCount() const {
+        return flagCount_;
+    }
+    constexpr const char* nameOrFlag(std::size_t i) const {
+        return nameOrFlags_[i];
+    }
+    constexpr const char* const* getNameOrFlags() const {
+        return nameOrFlags_;
+    }
+    constexpr enum Action::eAction getAction() const {
+        return action_;
+    }
+    constexpr std::size_t getNargs() const {
+        return nargs_;
+    }
+    constexpr const char* getHelp() const {
+        return help_;
+    }
+    constexpr const char* getMetavar() const {
+        return metavar_;
+    }
+    constexpr std::size_t defaultCount() const {
+        return defaultCount_;
+    }
+    constexpr const char* getDefault(std::size_t i) const {
+        return defaults_[i];
+    }
+    constexpr const char* const* getDefaults() const {
+        return defaults_;
+    }
+    constexpr bool isRequired() const {
+        return isRequired_;
+    }
+
+  private:
+    /**
+     * @brief Compare two strings in a constant expression
+     *
+     * @param first
+     * @param second
+     * @return [true] if strings are equal
+     */
+    static constexpr bool isEqual_(const char* first, const char* second) {
+        std::size_t i = 0;
+        while (first[i] != '\0' && first[i] == second[i]) {
+            ++i;
+        }
+        return first[i] == second[i];
+    }
+
+    /**
+     * @brief Same checks of Argument::validFormatFlag_
+     *
+     * @param flag
+     *
+     * @throw ArgumentException
+     */
+    static constexpr void validFormatFlag_(const char* flag) {
+        if (flag == nullptr || flag[0] != '-') {
+            throw ArgumentException(flag == nullptr ? "" : flag, "invalid flag not start by '-' character");
+        }
+        if (flag[1] == '\0') {
+            throw ArgumentException(flag, "invalid flag not be only '-' character");
+        }
+        if (flag[1] == '-' && flag[2] == '\0') {
+            throw ArgumentException(flag, "invalid flag not be only '--' characters");
+        }
+        if (flag[1] != '-' && flag[2] != '\0') {
+            throw ArgumentException(flag, "invalid short flag has not only one character");
+        }
+    }
+
+    /**
+     * @brief Same checks of Argument::typeConstructor_ and Argument::defaultsConstructor_
+     *
+     * @throw ArgumentException
+     */
+    constexpr void checkType_() const {
+        if (isPositionnal()) {
+            if (nargs_ == 0 || (action_ != Action::NONE && action_ != Action::INFINITE)) {
+                throw ArgumentException(nameOrFlags_[0],
+                                        "positional argument cannot use with this action or this nargs");
+            }
+        }
+        if (defaultCount_ == 0 || nargs_ == 0 || nargs_ == '+' || action_ == Action::STORE_TRUE ||
+            action_ == Action::STORE_FALSE || action_ == Action::HELP || action_ == Action::VERSION) {
+            return;
+        }
+        if (action_ == Action::NONE && defaultCount_ != nargs_) {
+            throw ArgumentException(nameOrFlags_[0], "invalid number of argument with number of default argument");
+        }
+        if (action_ != Action::NONE && nargs_ > 1 && defaultCount_ % nargs_ != 0) {
+            throw ArgumentException(nameOrFlags_[0], "invalid number of argument with number of default argument");
+        }
+    }
+
+    const char* nameOrFlags_[MAX_FLAGS];
+    std::size_t flagCount_;
+    enum Action::eAction action_;
+    std::size_t nargs_;
+    const char* help_;
+    const char* metavar_;
+    const char* defaults_[MAX_DEFAULTS];
+    std::size_t defaultCount_;
+    bool isRequired_;
+};
+
+/**
+ * @brief Static table of argument declarations checked at the construction,
+ *        a duplicate name or flag in a constexpr context is a compile error.
+ *
+ * @tparam N number of arguments
+ */
+template<std::size_t N>
+class Spec {
+  public:
+    /**
+     * @brief Construct a new Spec object
+     *
+     * @param options
+     *
+     * @throw ArgumentException
+     */
+    template<typename... T>
+    constexpr Spec(const T&... options) :
+        options_{options...} {
+        bool hasHelp = false;
+        bool hasVersion = false;
+        for (std::size_t i = 0; i < N; ++i) {
+            if (options_[i].getAction() == Action::HELP) {
+                if (hasHelp) {
+                    throw ArgumentException(options_[i].nameOrFlag(0), "help action already defined");
+                }
+                hasHelp = true;
+            }
+            if (options_[i].getAction() == Action::VERSION) {
+                if (hasVersion) {
+                    throw ArgumentException(options_[i].nameOrFlag(0), "version action already defined");
+                }
+                hasVersion = true;
+            }
+            for (std::size_t j = 0; j < options_[i].flagCount(); ++j) {
+                for (std::size_t k = 0; k < i; ++k) {
+                    for (std::size_t l = 0; l < options_[k].flagCount(); ++l) {
+                        if (OptionSpec::isEqual_(options_[i].nameOrFlag(j), options_[k].nameOrFlag(l))) {
+                            throw ArgumentException(options_[i].nameOrFlag(j), "invalid flag already exist");
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    constexpr std::size_t size() const {
+        return N;
+    }
+
+    constexpr const OptionSpec& operator[](std::size_t i) const {
+        return options_[i];
+    }
+
+  private:
+    OptionSpec options_[N];
+};
+
+template<typename... T>
+Spec(const T&...) -> Spec<sizeof...(T)>;
+
+} // namespace args
+
+} // namespace blet
+
+#endif // #if __cplusplus >= 201703L
+
+#endif // #ifndef BLET_ARGS_SPEC_H_
@@ -0,0 +1,138 @@
+/**
+ * args/table.h
+ *
+ * Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+ * Copyright (c) 2022-2023 BLET Mickael.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef BLET_ARGS_TABLE_H_
+#define BLET_ARGS_TABLE_H_
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "blet/args/action.h"
+
+namespace blet {
+
+namespace args {
+
+/**
+ * @brief Declaration of an argument in a generated table
+ */
+struct TableArgument {
+    const char* const* nameOrFlags;
+    std::size_t flagCount;
+    enum Action::eAction action;
+    std::size_t nargs;
+    const char* const* defaults;
+    std::size_t defaultCount;
+    const char* help;
+    const char* metavar;
+    bool isRequired;
+};
+
+/**
+ * @brief Slot of the perfect hash of names and flags
+ */
+struct TableSlot {
+    const char* nameOrFlag;
+    std::size_t argument;
+};
+
+/**
+ * @brief Static table of arguments generated by blet_args_codegen
+ */
+struct Table {
+    const TableArgument* arguments;
+    std::size_t argumentCount;
+    const TableSlot* slots;
+    std::size_t slotCount;
+    const unsigned int* displacements;
+    std::size_t displacementCount;
+    const std::size_t* shortOptions; // 128 entries of index + 1 of argument, 0 if not exists
+};
+
+/**
+ * @brief Hash of the perfect hash table (FNV-1a with a final mix)
+ *
+ * @param str
+ * @param size
+ * @param seed
+ * @return unsigned int
+ */
+inline unsigned int tableHash(const char* str, std::size_t size, unsigned int seed) {
+    unsigned int hash = 2166136261U ^ (seed * 0x9E3779B9U);
+    for (std::size_t i = 0; i < size; ++i) {
+        hash ^= static_cast<unsigned char>(str[i]);
+        hash *= 16777619U;
+    }
+    hash ^= hash >> 16;
+    hash *= 0x85EBCA6BU;
+    hash ^= hash >> 13;
+    hash *= 0xC2B2AE35U;
+    hash ^= hash >> 16;
+    return hash;
+}
+
+/**
+ * @brief Find the slot of name or flag in table
+ *
+ * @param table
+ * @param str
+ * @param size
+ * @return const TableSlot* slot or NULL if not found
+ */
+inline const TableSlot* tableFind(const Table& table, const char* str, std::size_t size) {
+    if (table.slotCount == 0) {
+        return NULL;
+    }
+    unsigned int displacement = table.displacements[tableHash(str, size, 0) % table.displacementCount];
+    const TableSlot* slot = &table.slots[tableHash(str, size, displacement) % table.slotCount];
+    if (slot->nameOrFlag == NULL) {
+        return NULL;
+    }
+    std::size_t i = 0;
+    while (i < size && slot->nameOrFlag[i] == str[i]) {
+        ++i;
+    }
+    if (i != size || slot->nameOrFlag[i] != '\0') {
+        return NULL;
+    }
+    return slot;
+}
+
+/**
+ * @brief Build a perfect hash of keys by hash and displace
+ *
+ * @param keys
+ * @param slots [out] index + 1 of key by slot, 0 if empty
+ * @param displacements [out] seed of tableHash by bucket
+ */
+void tableBuildPerfectHash(const std::vector<std::string>& keys, std::vector<std::size_t>* slots,
+                           std::vector<unsigned int>* displacements);
+
+} // namespace args
+
+} // namespace blet
+
+#endif // #ifndef BLET_ARGS_TABLE_H_
@@ -26,16 +26,39 @@
 #ifndef BLET_ARGS_USAGE_H_
 #define BLET_ARGS_USAGE_H_
 
+#include <cstddef>
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace blet {
 
 namespace args {
 
 class Args;
+class Argument;
+class UsageWriter;
 
 class Usage {
   public:
+    /**
+     * @brief Function called with each rendered part of usage message
+     *
+     * @param user pointer given to writeUsage
+     * @param str part of message (not null terminated)
+     * @param size size of part
+     */
+    typedef void (*Sink)(void* user, const char* str, std::size_t size);
+
+    /**
+     * @brief Selection of arguments in a filtered usage
+     */
+    enum eFilter {
+        FLAG_PREFIX = 0, // name or flag starts with the pattern
+        HELP_SEARCH,     // help contains the pattern (ignore case)
+        GROUP            // group is the pattern
+    };
+
     /**
      * @brief Construct a new Usage object
      *
@@ -55,14 +78,55 @@ class Usage {
      */
     void setUsage(const char* usage) {
         usage_ = usage;
+        clearUsageCache_();
     }
 
     /**
-     * @brief Get the usage message
+     * @brief Get the usage message, rendered once until the next change of arguments or usage settings
      *
+     * @return const std::string&
+     */
+    const std::string& getUsage() const;
+
+    /**
+     * @brief Render the usage message by a fixed size buffer directly in a file descriptor
+     *
+     * @param fd
+     */
+    void writeUsage(int fd) const;
+
+    /**
+     * @brief Render the usage message by a fixed size buffer in a sink function
+     *
+     * @param sink
+     * @param user pointer given to sink
+     */
+    void writeUsage(Sink sink, void* user) const;
+
+    /**
+     * @brief Get the usage lines of the arguments selected by the filter, in usage order.
+     *        Selection is done on an index built at the first call after a change of arguments.
+     *
+     * @param pattern
+     * @param filter
+     * @param first index of first selected argument (page)
+     * @param count maximum number of argument (page size)
      * @return std::string
      */
-    std::string getUsage() const;
+    std::string getUsage(const std::string& pattern, enum eFilter filter, std::size_t first = 0,
+                         std::size_t count = static_cast<std::size_t>(-1)) const;
+
+    /**
+     * @brief Render the usage lines of the arguments selected by the filter directly in a file descriptor
+     *
+     * @param fd
+     * @param pattern
+     * @param filter
+     * @param first index of first selected argument (page)
+     * @param count maximum number of argument (page size)
+     */
+    void writeUsage(int fd, const std::string& pattern, enum eFilter filter, std::size_t first = 0,
+                    std::size_t count = static_cast<std::size_t>(-1)) const;
 
     /**
      * @brief Set the description in usage message
@@ -71,6 +135,7 @@ class Usage {
      */
     void setDescription(const char* description) {
         description_ = description;
+        clearUsageCache_();
     }
 
     /**
@@ -89,6 +154,7 @@ class Usage {
      */
     void setEpilog(const char* epilog) {
         epilog_ = epilog;
+        clearUsageCache_();
     }
 
     /**
@@ -118,9 +184,75 @@ class Usage {
         usageArgsWidth_ = argsWidth;
         usageSepWidth_ = sepWidth;
         usageHelpWidth_ = helpWidth;
+        clearUsageCache_();
     }
 
   protected:
+    /**
+     * @brief Drop the rendered usage message after a change of arguments or usage settings
+     */
+    void clearUsageCache_() {
+        hasUsageCache_ = false;
+        hasUsageIndex_ = false;
+    }
+
+    /**
+     * @brief Get the bytes allocated by the usage strings and index out of this object
+     *
+     * @return std::size_t
+     */
+    std::size_t usageMemory_() const;
+
+    /**
+     * @brief Build the index of flags and help used by the filtered usage
+     */
+    void buildUsageIndex_() const;
+
+    /**
+     * @brief Render the usage lines of the arguments selected by the filter
+     *
+     * @param writer
+     * @param pattern
+     * @param filter
+     * @param first
+     * @param count
+     */
+    void writeFilteredUsage_(UsageWriter& writer, const std::string& pattern, enum eFilter filter, std::size_t first,
+                             std::size_t count) const;
+
+    /**
+     * @brief Get the first column of argument in usage
+     *
+     * @param argument
+     * @return std::string
+     */
+    std::string argumentOption_(Argument& argument) const;
+
+    /**
+     * @brief Render the usage message in writer
+     *
+     * @param writer
+     */
+    void writeUsage_(UsageWriter& writer) const;
+
+    /**
+     * @brief Render the usage of one argument: option column and wrapped help
+     *
+     * @param writer
+     * @param argument
+     * @param option first column
+     */
+    void writeArgumentUsage_(UsageWriter& writer, const Argument& argument, const std::string& option) const;
+
+    /**
+     * @brief Render the option column and the wrapped help of one usage line
+     *
+     * @param writer
+     * @param option first column
+     * @param help
+     */
+    void writeUsageLine_(UsageWriter& writer, const std::string& option, const std::string& help) const;
+
     Args& args_;
 
     std::string description_;
@@ -130,6 +262,17 @@ class Usage {
     std::size_t usageArgsWidth_;
     std::size_t usageSepWidth_;
     std::size_t usageHelpWidth_;
+
+    mutable std::string usageCache_;
+    mutable bool hasUsageCache_;
+
+    // filtered usage index: sorted flags, sorted groups, lower case help texts separated by '\0' and their argument
+    mutable std::vector<Argument*> indexArguments_;
+    mutable std::vector<std::pair<std::string, std::size_t> > indexFlags_;
+    mutable std::vector<std::pair<std::string, std::size_t> > indexGroups_;
+    mutable std::string indexHelp_;
+    mutable std::vector<std::pair<std::size_t, std::size_t> > indexHelpOffsets_;
+    mutable bool hasUsageIndex_;
 };
 
 } // namespace args
@@ -26,8 +26,10 @@
 #ifndef BLET_ARGS_UTILS_H_
 #define BLET_ARGS_UTILS_H_
 
+#include <cstddef>
 #include <cstring> // strchr
 #include <string>
+#include <vector>
 
 namespace blet {
 
@@ -121,6 +123,34 @@ inline bool takeArg(const char* arg, std::string* retOptionName, std::string* re
     }
 }
 
+/**
+ * @brief get the bytes allocated by str out of its object
+ *
+ * @param str
+ * @return std::size_t
+ */
+inline std::size_t stringMemory(const std::string& str) {
+    // small strings are stored in the object
+    if (str.capacity() <= std::string().capacity()) {
+        return 0;
+    }
+    return str.capacity() + 1;
+}
+
+/**
+ * @brief get the bytes allocated by strs out of its object
+ *
+ * @param strs
+ * @return std::size_t
+ */
+inline std::size_t stringsMemory(const std::vector<std::string>& strs) {
+    std::size_t ret = strs.capacity() * sizeof(std::string);
+    for (std::size_t i = 0; i < strs.size(); ++i) {
+        ret += stringMemory(strs[i]);
+    }
+    return ret;
+}
+
 } // namespace args
 
 } // namespace blet
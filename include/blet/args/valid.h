@@ -50,6 +50,15 @@ class IValid {
      * @return [true] arguments are valid, [false] arguments are not valid
      */
     virtual bool isValid(std::vector<std::string>& arguments) = 0;
+
+    /**
+     * @brief Add the valid values which start by @p prefix in @p candidates
+     *        used by the completion, by default nothing is added
+     *
+     * @param prefix
+     * @param candidates
+     */
+    virtual void complete(const std::string& /*prefix*/, std::vector<std::string>* /*candidates*/) const {}
 };
 
 class ValidNumber : public IValid {
@@ -124,8 +133,18 @@ class ValidChoise : public IValid {
      */
     bool isValid(std::vector<std::string>& args);
 
+    /**
+     * @brief Add the choises which start by @p prefix in @p candidates in sorted order
+     *
+     * @param prefix
+     * @param candidates
+     */
+    void complete(const std::string& prefix, std::vector<std::string>* candidates) const;
+
   private:
     std::vector<std::string> choises_;
+    // indexes of choises in sorted order for the completion
+    std::vector<std::size_t> sortedChoises_;
 };
 
 class ValidPath : public IValid {
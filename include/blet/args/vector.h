@@ -27,6 +27,7 @@
 #define BLET_ARGS_VECTOR_H_
 
 #include <string>
+#include <utility> // move
 #include <vector>
 
 namespace blet {
@@ -84,6 +85,14 @@ class Vector : public std::vector<std::string> {
 #if __cplusplus >= 201103L
     Vector(const std::initializer_list<std::string>& l) :
         std::vector<std::string>(l) {}
+
+    Vector(std::string&& v) :
+        std::vector<std::string>() {
+        std::vector<std::string>::push_back(std::move(v));
+    }
+
+    Vector(std::vector<std::string>&& v) :
+        std::vector<std::string>(std::move(v)) {}
 #endif
 };
 
@@ -0,0 +1,125 @@
+/**
+ * args/view.h
+ *
+ * Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+ * Copyright (c) 2022-2023 BLET Mickael.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef BLET_ARGS_VIEW_H_
+#define BLET_ARGS_VIEW_H_
+
+#include <cstddef>
+#include <cstring> // memcmp, strlen
+#include <ostream>
+#include <string>
+
+#if __cplusplus >= 201703L
+#include <string_view>
+#endif
+
+namespace blet {
+
+namespace args {
+
+/**
+ * @brief Non owning reference on a string of an argument
+ */
+class StringView {
+  public:
+    StringView() :
+        data_(""),
+        size_(0) {}
+    StringView(const char* str) :
+        data_(str),
+        size_(::strlen(str)) {}
+    StringView(const char* data, std::size_t size) :
+        data_(data),
+        size_(size) {}
+    StringView(const std::string& str) :
+        data_(str.c_str()),
+        size_(str.size()) {}
+
+    const char* data() const {
+        return data_;
+    }
+
+    std::size_t size() const {
+        return size_;
+    }
+
+    bool empty() const {
+        return size_ == 0;
+    }
+
+    const char* begin() const {
+        return data_;
+    }
+
+    const char* end() const {
+        return data_ + size_;
+    }
+
+    char operator[](std::size_t index) const {
+        return data_[index];
+    }
+
+    /**
+     * @brief Copy the view in a new string
+     *
+     * @return std::string
+     */
+    std::string str() const {
+        return std::string(data_, size_);
+    }
+
+    operator std::string() const {
+        return str();
+    }
+
+#if __cplusplus >= 201703L
+    operator std::string_view() const {
+        return std::string_view(data_, size_);
+    }
+#endif
+
+    friend bool operator==(const StringView& lhs, const StringView& rhs) {
+        return lhs.size_ == rhs.size_ && ::memcmp(lhs.data_, rhs.data_, lhs.size_) == 0;
+    }
+
+    friend bool operator!=(const StringView& lhs, const StringView& rhs) {
+        return !(lhs == rhs);
+    }
+
+    friend std::ostream& operator<<(std::ostream& os, const StringView& view) {
+        os.write(view.data_, view.size_);
+        return os;
+    }
+
+  private:
+    const char* data_;
+    std::size_t size_;
+};
+
+} // namespace args
+
+} // namespace blet
+
+#endif // #ifndef BLET_ARGS_VIEW_H_
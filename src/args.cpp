@@ -26,10 +26,14 @@
 #include "blet/args/args.h"
 
 #include <algorithm>
+#include <climits>
+#include <cstring>
 #include <iostream>
+#include <new>
 #include <sstream>
 
 #include "blet/args/argument.h"
+#include "blet/args/input.h"
 #include "blet/args/utils.h"
 #include "blet/args/vector.h"
 
@@ -40,42 +44,126 @@ namespace blet {
 
 namespace args {
 
+/**
+ * @brief Construct a empty element at the end of elements without copy
+ *
+ * @param elements
+ * @return ArgumentElement& new element
+ */
+static inline ArgumentElement& s_emplaceBack(std::vector<ArgumentElement>& elements) {
+#if __cplusplus >= 201103L
+    elements.emplace_back();
+#else
+    elements.push_back(ArgumentElement());
+#endif
+    return elements.back();
+}
+
+/**
+ * @brief Get the number of arguments of a block, the blocks grow like a vector until 256 arguments
+ *        for not reserve too many unused arguments
+ *
+ * @param index index of block
+ * @return std::size_t
+ */
+static inline std::size_t s_argumentBlockSize(std::size_t index) {
+    std::size_t size = 16;
+    for (std::size_t i = 0; i < index && size < 256; ++i) {
+        size *= 2;
+    }
+    return size;
+}
+
+static void s_sinkToOstream(void* os, const char* str, std::size_t size) {
+    static_cast<std::ostream*>(os)->write(str, size);
+}
+
+static const std::size_t s_bitsPerWord = sizeof(unsigned long) * CHAR_BIT;
+
+static inline bool s_compareFlags(const std::pair<const char*, Argument*>& first,
+                                  const std::pair<const char*, Argument*>& second) {
+    return ::strcmp(first.first, second.first) < 0;
+}
+
+static inline bool s_compareFlag(const std::pair<const char*, Argument*>& first, const char* prefix) {
+    return ::strcmp(first.first, prefix) < 0;
+}
+
 Args::Args(bool addHelp) :
     Usage(*this),
     binaryName_(),
     arguments_(),
     argumentFromName_(),
+    table_(NULL),
+    snapshot_(NULL),
+    tableArguments_(),
+    snapshots_(),
+    elementPool_(),
+    argumentBlocks_(),
+    freeArguments_(),
+    argumentFromIndex_(),
+    freeIndexes_(),
+    nextGeneration_(0),
+    existBits_(),
+    requiredBits_(),
+    destBits_(),
+    constraints_(),
+    subcommands_(),
+    subcommandSlots_(),
+    selectedSubcommand_(0),
     helpOption_(NULL),
     versionOption_(NULL),
     isAlternative_(false),
     isStrict_(false),
     isHelpException_(false),
     isVersionException_(false),
-    additionalArguments_() {
+    responseFile_(ResponseFile::NONE),
+    isLiteralHelp_(false),
+    isAbbreviation_(false),
+    additionalArguments_(),
+    sortedFlags_(),
+    hasSortedFlags_(false) {
     if (addHelp) {
         // define helpOption_
-        addArgument("-h").flag("--help").action(Action::HELP).help("show this help message and exit");
+        Argument& argument = addArgument("-h").flag("--help").action(Action::HELP);
+        argument.helpLiteral_ = "show this help message and exit";
     }
 }
 
 Args::~Args() {
     // delete all new element
-    for (std::list<Argument*>::iterator it = arguments_.begin(); it != arguments_.end(); ++it) {
-        delete (*it);
+    deleteArguments_();
+    deleteSubcommands_();
+    for (std::size_t i = 0; i < snapshots_.size(); ++i) {
+        delete snapshots_[i];
     }
 }
 
 void Args::parseArguments(int argc, char* argv[]) {
+    // tokens of response files are only valid during the parsing
+    ResponseFile responseFile(responseFile_);
+    if (responseFile.expand(argc, argv)) {
+        parseArguments_(responseFile.argc(), Tokens(responseFile));
+    }
+    else {
+        parseArguments_(argc, Tokens(argv));
+    }
+}
+
+void Args::parseArguments_(int argc, const Tokens& argv) {
     // clear the arguments
-    for (std::list<Argument*>::iterator it = arguments_.begin(); it != arguments_.end(); ++it) {
+    for (std::vector<Argument*>::iterator it = arguments_.begin(); it != arguments_.end(); ++it) {
         (*it)->clear_();
     }
+    std::fill(existBits_.begin(), existBits_.end(), 0UL);
+    selectedSubcommand_ = 0;
     // get argv[0] if filename is empty
     if (binaryName_.empty()) {
         binaryName_ = argv[0];
+        clearUsageCache_();
     }
     // save index of "--" if exist
-    int endIndex = endOptionIndex(argc, argv);
+    int endIndex = argv.endOptionIndex(argc);
     // foreach argument
     for (int i = 1; i < argc; ++i) {
         if (isShortOption(argv[i])) {
@@ -93,6 +181,17 @@ void Args::parseArguments(int argc, char* argv[]) {
             break;
         }
         else {
+            std::size_t subcommandIndex = findSubcommand_(argv[i]);
+            if (subcommandIndex < subcommands_.size()) {
+                // the next arguments are parsed by the subcommand
+                selectedSubcommand_ = subcommandIndex + 1;
+                Subcommand& subcommand = subcommands_[subcommandIndex];
+                Args& args = subcommandArgs_(subcommand);
+                args.binaryName_ = binaryName_ + " " + subcommand.name;
+                args.clearUsageCache_();
+                args.parseArguments_(argc - i, Tokens(argv, i));
+                break;
+            }
             parsePositionnalArgument_(endIndex, argv, &i);
         }
     }
@@ -102,7 +201,8 @@ void Args::parseArguments(int argc, char* argv[]) {
             throw HelpException(getUsage().c_str());
         }
         else {
-            std::cout << getUsage() << std::endl;
+            writeUsage(&s_sinkToOstream, &std::cout);
+            std::cout << std::endl;
             clear();
             exit(0);
         }
@@ -118,24 +218,43 @@ void Args::parseArguments(int argc, char* argv[]) {
             exit(0);
         }
     }
-    // check require option
-    std::list<Argument*>::iterator it;
-    for (it = arguments_.begin(); it != arguments_.end(); ++it) {
-        if ((*it)->isRequired_ && (*it)->isExist_ == false) {
-            if ((*it)->type_ == Argument::POSITIONAL_ARGUMENT) {
-                throw ParseArgumentRequiredException((*it)->nameOrFlags_.front().c_str(), "argument is required");
-            }
-            else {
-                throw ParseArgumentRequiredException((*it)->nameOrFlags_.front().c_str(), "option is required");
+    // check require option: the required bits not in the exist bits
+    for (std::size_t i = 0; i < requiredBits_.size(); ++i) {
+        if ((requiredBits_[i] & ~existBits_[i]) != 0) {
+            // first missing argument in the order of usage
+            std::vector<Argument*>::iterator it;
+            for (it = arguments_.begin(); it != arguments_.end(); ++it) {
+                if ((*it)->isRequired_ && (*it)->isExist_ == false) {
+                    if ((*it)->type_ == Argument::POSITIONAL_ARGUMENT) {
+                        throw ParseArgumentRequiredException((*it)->nameOrFlags_.front().c_str(),
+                                                             "argument is required");
+                    }
+                    else {
+                        throw ParseArgumentRequiredException((*it)->nameOrFlags_.front().c_str(),
+                                                             "option is required");
+                    }
+                }
             }
         }
     }
-    // check valid configuration function
-    for (it = arguments_.begin(); it != arguments_.end(); ++it) {
-        if ((*it)->isExist_ && (*it)->valid_ != NULL) {
+    checkConstraints_();
+    // check valid configuration function and dest of arguments which exist or have a dest in the order of usage
+    bool hasBits = false;
+    for (std::size_t i = 0; i < existBits_.size() && !hasBits; ++i) {
+        hasBits = (existBits_[i] | destBits_[i]) != 0;
+    }
+    std::vector<Argument*>::iterator itArgument;
+    for (itArgument = arguments_.begin(); hasBits && itArgument != arguments_.end(); ++itArgument) {
+        Argument* argument = *itArgument;
+        std::size_t word = argument->index_ / s_bitsPerWord;
+        if ((((existBits_[word] | destBits_[word]) >> (argument->index_ % s_bitsPerWord)) & 1UL) == 0) {
+            continue;
+        }
+        // streamed values are checked during the parse
+        if (argument->isExist_ && argument->valid_ != NULL && !argument->isStreamed_()) {
             try {
                 std::vector<std::string> arguments;
-                switch ((*it)->type_) {
+                switch (argument->type_) {
                     case Argument::POSITIONAL_ARGUMENT:
                     case Argument::NUMBER_POSITIONAL_ARGUMENT:
                     case Argument::INFINITE_POSITIONAL_ARGUMENT:
@@ -147,21 +266,21 @@ void Args::parseArguments(int argc, char* argv[]) {
                     case Argument::MULTI_INFINITE_OPTION:
                     case Argument::MULTI_NUMBER_OPTION:
                     case Argument::MULTI_NUMBER_INFINITE_OPTION: {
-                        const Argument& cArg = *(*it);
+                        const Argument& cArg = *argument;
                         arguments = cArg.operator std::vector<std::string>();
                         break;
                     }
                     default:
                         break;
                 }
-                if ((*it)->valid_->isValid(arguments) == false) {
+                if (argument->valid_->isValid(arguments) == false) {
                     throw ParseArgumentValidException("invalid check function");
                 }
-                switch ((*it)->type_) {
+                switch (argument->type_) {
                     case Argument::POSITIONAL_ARGUMENT:
                     case Argument::SIMPLE_OPTION:
                         if (!arguments.empty()) {
-                            (*it)->argument_ = arguments.front();
+                            argument->argument_ = arguments.front();
                         }
                         break;
                     case Argument::NUMBER_OPTION:
@@ -170,17 +289,17 @@ void Args::parseArguments(int argc, char* argv[]) {
                     case Argument::MULTI_INFINITE_OPTION:
                     case Argument::NUMBER_POSITIONAL_ARGUMENT:
                     case Argument::INFINITE_POSITIONAL_ARGUMENT:
-                        for (std::size_t i = 0; i < (*it)->size() && i < arguments.size(); ++i) {
-                            (*it)->at(i).argument_ = arguments[i];
+                        for (std::size_t i = 0; i < argument->size() && i < arguments.size(); ++i) {
+                            argument->at(i).argument_ = arguments[i];
                         }
                         break;
                     case Argument::MULTI_NUMBER_OPTION:
                     case Argument::MULTI_NUMBER_INFINITE_OPTION:
                     case Argument::INFINITE_NUMBER_POSITIONAL_ARGUMENT: {
                         std::size_t i = 0;
-                        for (std::size_t j = 0; j < (*it)->size() && i < arguments.size(); ++j) {
-                            for (std::size_t k = 0; k < (*it)->at(j).size() && i < arguments.size(); ++k) {
-                                (*it)->at(j).at(k).argument_ = arguments[i];
+                        for (std::size_t j = 0; j < argument->size() && i < arguments.size(); ++j) {
+                            for (std::size_t k = 0; k < argument->at(j).size() && i < arguments.size(); ++k) {
+                                argument->at(j).at(k).argument_ = arguments[i];
                                 ++i;
                             }
                         }
@@ -190,20 +309,184 @@ void Args::parseArguments(int argc, char* argv[]) {
                         throw ParseArgumentValidException("invalid type option for use valid");
                         break;
                 }
+                // the string cache may be rendered before the write back
+                argument->hasStringCache_ = false;
             }
             catch (const ParseArgumentValidException& e) {
                 // add name or first flag in exception
-                throw ParseArgumentValidException((*it)->nameOrFlags_.front().c_str(), e.what());
+                throw ParseArgumentValidException(argument->nameOrFlags_.front().c_str(), e.what());
             }
         }
-        // tranform argument to number
-        (*it)->toNumber_();
         // dest
-        (*it)->toDest_();
+        argument->toDest_();
+    }
+}
+
+Argument* Args::newArgument_() {
+    if (freeArguments_.empty()) {
+        std::size_t size = s_argumentBlockSize(argumentBlocks_.size());
+        char* block = static_cast<char*>(::operator new(size * sizeof(Argument)));
+        argumentBlocks_.push_back(block);
+        freeArguments_.reserve(size);
+        // the first slots are used first
+        for (std::size_t i = size; i > 0; --i) {
+            freeArguments_.push_back(reinterpret_cast<Argument*>(block + (i - 1) * sizeof(Argument)));
+        }
+    }
+    Argument* argument = new (freeArguments_.back()) Argument(*this);
+    freeArguments_.pop_back();
+    // the handles of a previous argument of same index are invalid
+    argument->generation_ = nextGeneration_++;
+    if (!freeIndexes_.empty()) {
+        // reuse the index of a removed argument, its bits are already reset
+        argument->index_ = freeIndexes_.back();
+        freeIndexes_.pop_back();
+        argumentFromIndex_[argument->index_] = argument;
+        return argument;
+    }
+    argument->index_ = argumentFromIndex_.size();
+    argumentFromIndex_.push_back(argument);
+    std::size_t words = (argumentFromIndex_.size() + s_bitsPerWord - 1) / s_bitsPerWord;
+    if (existBits_.size() < words) {
+        existBits_.resize(words, 0UL);
+        requiredBits_.resize(words, 0UL);
+        destBits_.resize(words, 0UL);
+    }
+    return argument;
+}
+
+void Args::deleteArgument_(Argument* argument) {
+    argumentFromIndex_[argument->index_] = NULL;
+    setBit_(existBits_, argument->index_, false);
+    setBit_(requiredBits_, argument->index_, false);
+    setBit_(destBits_, argument->index_, false);
+    // the constraints of a removed source can't apply to the next argument of index
+    std::vector<Constraint>::iterator it = constraints_.begin();
+    while (it != constraints_.end()) {
+        if (it->getType() != Constraint::EXCLUSIVE && it->getSource() == argument->index_) {
+            it = constraints_.erase(it);
+        }
+        else {
+            it->reset(argument->index_);
+            ++it;
+        }
+    }
+    freeIndexes_.push_back(argument->index_);
+    argument->~Argument();
+    freeArguments_.push_back(argument);
+}
+
+void Args::deleteLastArguments_(std::size_t size) {
+    for (std::size_t i = size; i < arguments_.size(); ++i) {
+        if (arguments_[i] == helpOption_) {
+            helpOption_ = NULL;
+        }
+        else if (arguments_[i] == versionOption_) {
+            versionOption_ = NULL;
+        }
+        deleteArgument_(arguments_[i]);
+    }
+    arguments_.resize(size);
+    hasSortedFlags_ = false;
+    clearUsageCache_();
+}
+
+void Args::deleteArguments_() {
+    for (std::size_t i = 0; i < arguments_.size(); ++i) {
+        arguments_[i]->~Argument();
+    }
+    arguments_.clear();
+    freeArguments_.clear();
+    argumentFromIndex_.clear();
+    freeIndexes_.clear();
+    sortedFlags_.clear();
+    hasSortedFlags_ = false;
+    existBits_.clear();
+    requiredBits_.clear();
+    destBits_.clear();
+    for (std::size_t i = 0; i < argumentBlocks_.size(); ++i) {
+        ::operator delete(argumentBlocks_[i]);
+    }
+    argumentBlocks_.clear();
+}
+
+void Args::setBit_(std::vector<unsigned long>& bits, std::size_t index, bool value) {
+    if (value) {
+        bits[index / s_bitsPerWord] |= 1UL << (index % s_bitsPerWord);
+    }
+    else {
+        bits[index / s_bitsPerWord] &= ~(1UL << (index % s_bitsPerWord));
+    }
+}
+
+void Args::setExist_(Argument* argument) {
+    argument->isExist_ = true;
+    setBit_(existBits_, argument->index_, true);
+}
+
+void Args::insertArgument_(Argument* argument) {
+    hasSortedFlags_ = false;
+    arguments_.insert(std::upper_bound(arguments_.begin(), arguments_.end(), argument, &Argument::compareOption_),
+                      argument);
+}
+
+void Args::sortArguments_() {
+    hasSortedFlags_ = false;
+    std::stable_sort(arguments_.begin(), arguments_.end(), &Argument::compareOption_);
+}
+
+void Args::recycleElements_(ArgumentElement& elements) {
+    while (!elements.empty()) {
+        ArgumentElement& element = elements.back();
+        recycleElements_(element);
+        element.argument_.clear();
+        s_emplaceBack(elementPool_).swap_(element);
+        elements.pop_back();
+    }
+}
+
+ArgumentElement& Args::newElement_(ArgumentElement& elements) {
+    ArgumentElement& element = s_emplaceBack(elements);
+    if (!elementPool_.empty()) {
+        element.swap_(elementPool_.back());
+        elementPool_.pop_back();
+    }
+    return element;
+}
+
+ArgumentElement& Args::newElement_(ArgumentElement& elements, const char* value) {
+    ArgumentElement& element = newElement_(elements);
+    element.argument_ = value;
+    return element;
+}
+
+void Args::findFields_(const Field* fields, const Argument** arguments, std::size_t size) const {
+    for (std::size_t i = 0; i < size; ++i) {
+        arguments[i] = findArgument_(fields[i].nameOrFlag);
+        if (arguments[i] == NULL) {
+            throw AccessDeniedException(fields[i].nameOrFlag, "argument not found");
+        }
+    }
+}
+
+void Args::toFields_(void* object, const Field* fields, const Argument* const* arguments, std::size_t size) const {
+    for (std::size_t i = 0; i < size; ++i) {
+        fields[i].toField(*arguments[i], static_cast<char*>(object) + fields[i].offset);
     }
 }
 
 Argument& Args::addArgument(const Vector& nameOrFlags) {
+    Vector newNameOrFlags(nameOrFlags);
+    return addArgument_(newNameOrFlags);
+}
+
+#if __cplusplus >= 201103L
+Argument& Args::addArgument(Vector&& nameOrFlags) {
+    return addArgument_(nameOrFlags);
+}
+#endif
+
+Argument& Args::addArgument_(Vector& nameOrFlags) {
     if (nameOrFlags.empty()) {
         throw ArgumentException("", "invalid empty flag");
     }
@@ -213,12 +496,12 @@ Argument& Args::addArgument(const Vector& nameOrFlags) {
         if (nameOrFlags.front().empty()) {
             throw ArgumentException("", "bad name argument");
         }
-        if (argumentFromName_.find(nameOrFlags.front()) != argumentFromName_.end()) {
+        if (findArgument_(nameOrFlags.front()) != NULL) {
             throw ArgumentException(nameOrFlags.front().c_str(), "bad name argument already exist");
         }
         // create argument
-        argument = new Argument(*this);
-        argument->nameOrFlags_.push_back(nameOrFlags.front());
+        argument = newArgument_();
+        argument->nameOrFlags_.swap(nameOrFlags);
         argument->nargs_ = 1;
         argument->type_ = Argument::POSITIONAL_ARGUMENT;
     }
@@ -227,7 +510,7 @@ Argument& Args::addArgument(const Vector& nameOrFlags) {
 
         for (std::size_t i = 0; i < nameOrFlags.size(); ++i) {
             Argument::validFormatFlag_(nameOrFlags[i].c_str());
-            if (argumentFromName_.find(nameOrFlags.front()) != argumentFromName_.end()) {
+            if (findArgument_(nameOrFlags.front()) != NULL) {
                 throw ArgumentException(nameOrFlags.front().c_str(), "invalid flag already exist");
             }
             if (std::find(newFlags.begin(), newFlags.end(), nameOrFlags[i]) == newFlags.end()) {
@@ -235,75 +518,393 @@ Argument& Args::addArgument(const Vector& nameOrFlags) {
             }
         }
 
-        argument = new Argument(*this);
-        argument->nameOrFlags_ = nameOrFlags;
+        argument = newArgument_();
+        argument->nameOrFlags_.swap(nameOrFlags);
         argument->sortNameOrFlags_();
     }
 
-    arguments_.push_back(argument);
-    Argument** addrNewArgument = &(arguments_.back());
-    argument->this_ = addrNewArgument;
     for (std::size_t i = 0; i < argument->nameOrFlags_.size(); ++i) {
-        argumentFromName_.insert(std::pair<std::string, Argument**>(argument->nameOrFlags_[i], addrNewArgument));
+        argumentFromName_.insert(std::pair<std::string, Argument*>(argument->nameOrFlags_[i], argument));
+    }
+    insertArgument_(argument);
+    clearUsageCache_();
+    return *argument;
+}
+
+void Args::addArguments(const Table& table) {
+    // check if all names or flags not exists
+    for (std::size_t i = 0; i < table.argumentCount; ++i) {
+        const TableArgument& tableArgument = table.arguments[i];
+        for (std::size_t j = 0; j < tableArgument.flagCount; ++j) {
+            if (findArgument_(tableArgument.nameOrFlags[j]) != NULL) {
+                throw ArgumentException(tableArgument.nameOrFlags[j], "invalid flag already exist");
+            }
+        }
+        if (tableArgument.action == Action::HELP && helpOption_ != NULL) {
+            throw ArgumentException(tableArgument.nameOrFlags[0], "help action already defined");
+        }
+        if (tableArgument.action == Action::VERSION && versionOption_ != NULL) {
+            throw ArgumentException(tableArgument.nameOrFlags[0], "version action already defined");
+        }
+    }
+    dropIndex_();
+    std::size_t size = arguments_.size();
+    tableArguments_.reserve(table.argumentCount);
+    arguments_.reserve(size + table.argumentCount);
+    try {
+        for (std::size_t i = 0; i < table.argumentCount; ++i) {
+            // the names and flags are only in the perfect hash of table until dropIndex_
+            tableArguments_.push_back(newTableArgument_(table.arguments[i]));
+        }
     }
-    arguments_.sort(&Argument::compareOption_);
-    return **addrNewArgument;
+    catch (...) {
+        // remove the arguments of table (e.g. positional argument with a bad action)
+        tableArguments_.clear();
+        deleteLastArguments_(size);
+        throw;
+    }
+    table_ = &table;
+    sortArguments_();
+    clearUsageCache_();
+}
+
+Argument* Args::newTableArgument_(const TableArgument& tableArgument) {
+    Argument* argument = newArgument_();
+    arguments_.push_back(argument);
+    argument->nameOrFlags_.assign(tableArgument.nameOrFlags, tableArgument.nameOrFlags + tableArgument.flagCount);
+    if (tableArgument.nameOrFlags[0][0] != '-') {
+        argument->type_ = Argument::POSITIONAL_ARGUMENT;
+    }
+    else {
+        argument->sortNameOrFlags_();
+    }
+    argument->nargs_ = tableArgument.nargs;
+    argument->action_ = tableArgument.action;
+    argument->typeConstructor_();
+    if (tableArgument.defaultCount > 0) {
+        argument->defaults_.assign(tableArgument.defaults, tableArgument.defaults + tableArgument.defaultCount);
+        argument->defaultsConstructor_();
+    }
+    argument->isRequired_ = tableArgument.isRequired;
+    setBit_(requiredBits_, argument->index_, argument->isRequired_);
+    argument->helpLiteral_ = tableArgument.help;
+    argument->metavarLiteral_ = tableArgument.metavar;
+    return argument;
 }
 
 void Args::removeArguments(const Vector& nameOrFlags) {
     if (nameOrFlags.empty()) {
         throw ArgumentException("", "invalid empty flag");
     }
-    std::vector<std::map<std::string, Argument**>::iterator> vIt;
+    // the perfect hash of table or snapshot can not forget a flag
+    dropIndex_();
+    std::vector<std::map<std::string, Argument*>::iterator> vIt;
     // check if all element is exists and store iterator
     for (std::size_t i = 0; i < nameOrFlags.size(); ++i) {
-        std::map<std::string, Argument**>::iterator it = argumentFromName_.find(nameOrFlags[i]);
+        std::map<std::string, Argument*>::iterator it = argumentFromName_.find(nameOrFlags[i]);
         if (it == argumentFromName_.end()) {
             throw ArgumentException(nameOrFlags[i].c_str(), "argument not found");
         }
         vIt.push_back(it);
     }
     for (std::size_t i = 0; i < vIt.size(); ++i) {
-        Argument** ppArgument = vIt[i]->second;
+        Argument* pArgument = vIt[i]->second;
         // remove name or flag in argument object
         std::vector<std::string>::iterator namesIt =
-            std::find((*ppArgument)->nameOrFlags_.begin(), (*ppArgument)->nameOrFlags_.end(), vIt[i]->first);
-        (*ppArgument)->nameOrFlags_.erase(namesIt);
+            std::find(pArgument->nameOrFlags_.begin(), pArgument->nameOrFlags_.end(), vIt[i]->first);
+        pArgument->nameOrFlags_.erase(namesIt);
         // remove argument
         argumentFromName_.erase(vIt[i]);
-        // check if ppArgument not exists
-        std::map<std::string, Argument**>::iterator it = argumentFromName_.begin();
-        for (it = argumentFromName_.begin(); it != argumentFromName_.end(); ++it) {
-            if (it->second == ppArgument) {
-                break;
-            }
-        }
-        // remove from argument list
-        if (it == argumentFromName_.end()) {
-            std::list<Argument*>::iterator aIt = std::find(arguments_.begin(), arguments_.end(), *ppArgument);
+        // remove from arguments if it has no more name or flag
+        if (pArgument->nameOrFlags_.empty()) {
+            std::vector<Argument*>::iterator aIt = std::find(arguments_.begin(), arguments_.end(), pArgument);
             if (*aIt == helpOption_) {
                 helpOption_ = NULL;
             }
             else if (*aIt == versionOption_) {
                 versionOption_ = NULL;
             }
-            delete (*aIt);
             arguments_.erase(aIt);
+            deleteArgument_(pArgument);
         }
         else {
-            (**it->second).sortNameOrFlags_();
+            pArgument->sortNameOrFlags_();
+        }
+    }
+    sortArguments_();
+    clearUsageCache_();
+}
+
+void Args::addExclusiveGroup(const Vector& nameOrFlags, bool required__) {
+    Constraint constraint(Constraint::EXCLUSIVE, 0, required__);
+    addConstraint_(constraint, nameOrFlags);
+}
+
+void Args::addRequirement(const std::string& nameOrFlag, const Vector& requiredNameOrFlags) {
+    Argument* argument = findArgument_(nameOrFlag);
+    if (argument == NULL) {
+        throw ArgumentException(nameOrFlag.c_str(), "argument not found");
+    }
+    Constraint constraint(Constraint::REQUIRES, argument->index_, false);
+    addConstraint_(constraint, requiredNameOrFlags);
+}
+
+void Args::addConflict(const std::string& nameOrFlag, const Vector& conflictNameOrFlags) {
+    Argument* argument = findArgument_(nameOrFlag);
+    if (argument == NULL) {
+        throw ArgumentException(nameOrFlag.c_str(), "argument not found");
+    }
+    Constraint constraint(Constraint::CONFLICTS, argument->index_, false);
+    addConstraint_(constraint, conflictNameOrFlags);
+}
+
+void Args::addConstraint_(Constraint& constraint, const Vector& nameOrFlags) {
+    if (nameOrFlags.empty()) {
+        throw ArgumentException("", "invalid empty constraint");
+    }
+    for (std::size_t i = 0; i < nameOrFlags.size(); ++i) {
+        Argument* argument = findArgument_(nameOrFlags[i]);
+        if (argument == NULL) {
+            throw ArgumentException(nameOrFlags[i].c_str(), "argument not found");
+        }
+        constraint.set(argument->index_);
+    }
+    constraints_.push_back(constraint);
+}
+
+void Args::checkConstraints_() const {
+    for (std::size_t i = 0; i < constraints_.size(); ++i) {
+        const Constraint& constraint = constraints_[i];
+        switch (constraint.getType()) {
+            case Constraint::EXCLUSIVE: {
+                std::size_t count = constraint.count(existBits_);
+                if (count > 1) {
+                    // the second argument of group is not allowed with the first
+                    std::size_t first = constraint.next(0);
+                    while (!argumentFromIndex_[first]->isExist_) {
+                        first = constraint.next(first + 1);
+                    }
+                    std::size_t second = constraint.next(first + 1);
+                    while (!argumentFromIndex_[second]->isExist_) {
+                        second = constraint.next(second + 1);
+                    }
+                    throw ParseArgumentException(
+                        argumentFromIndex_[second]->nameOrFlags_.front().c_str(),
+                        ("not allowed with argument " + argumentFromIndex_[first]->nameOrFlags_.front()).c_str());
+                }
+                // the arguments of group can be removed
+                if (count == 0 && constraint.isRequired() && constraint.next(0) != Constraint::npos) {
+                    std::string message("one of the arguments");
+                    std::size_t index = constraint.next(0);
+                    const char* firstArgument = argumentFromIndex_[index]->nameOrFlags_.front().c_str();
+                    for (; index != Constraint::npos; index = constraint.next(index + 1)) {
+                        message += " " + argumentFromIndex_[index]->nameOrFlags_.front();
+                    }
+                    message += " is required";
+                    throw ParseArgumentRequiredException(firstArgument, message.c_str());
+                }
+                break;
+            }
+            case Constraint::REQUIRES: {
+                const Argument* source = argumentFromIndex_[constraint.getSource()];
+                if (source != NULL && source->isExist_ && !constraint.isIn(existBits_)) {
+                    std::size_t index = constraint.next(0);
+                    while (argumentFromIndex_[index]->isExist_) {
+                        index = constraint.next(index + 1);
+                    }
+                    throw ParseArgumentRequiredException(
+                        argumentFromIndex_[index]->nameOrFlags_.front().c_str(),
+                        ("argument is required by " + source->nameOrFlags_.front()).c_str());
+                }
+                break;
+            }
+            case Constraint::CONFLICTS: {
+                const Argument* source = argumentFromIndex_[constraint.getSource()];
+                if (source != NULL && source->isExist_ && constraint.count(existBits_) > 0) {
+                    std::size_t index = constraint.next(0);
+                    while (!argumentFromIndex_[index]->isExist_) {
+                        index = constraint.next(index + 1);
+                    }
+                    throw ParseArgumentException(
+                        source->nameOrFlags_.front().c_str(),
+                        ("not allowed with argument " + argumentFromIndex_[index]->nameOrFlags_.front()).c_str());
+                }
+                break;
+            }
+        }
+    }
+}
+
+void Args::addSubcommand_(const std::string& name, void (*factory)(), Args* (*newArgs)(bool addHelp),
+                          void (*buildArgs)(Args& args, void (*factory)()), const std::string& help) {
+    if (name.empty()) {
+        throw ArgumentException("", "invalid empty subcommand");
+    }
+    if (name[0] == '-') {
+        throw ArgumentException(name.c_str(), "invalid subcommand start by '-' character");
+    }
+    if (factory == NULL) {
+        throw ArgumentException(name.c_str(), "invalid NULL factory");
+    }
+    if (findSubcommand_(name.c_str()) < subcommands_.size()) {
+        throw ArgumentException(name.c_str(), "invalid subcommand already exist");
+    }
+    Subcommand subcommand;
+    subcommand.name = name;
+    subcommand.help = help;
+    subcommand.factory = factory;
+    subcommand.newArgs = newArgs;
+    subcommand.buildArgs = buildArgs;
+    subcommand.args = NULL;
+    subcommands_.push_back(subcommand);
+    insertSubcommand_(subcommands_.size() - 1);
+    clearUsageCache_();
+}
+
+const std::string& Args::getSubcommandName() const {
+    static const std::string empty;
+    if (selectedSubcommand_ == 0) {
+        return empty;
+    }
+    return subcommands_[selectedSubcommand_ - 1].name;
+}
+
+Args& Args::getSubcommand() {
+    if (selectedSubcommand_ == 0) {
+        throw AccessDeniedException("", "subcommand not selected");
+    }
+    return *subcommands_[selectedSubcommand_ - 1].args;
+}
+
+Args& Args::getSubcommand(const std::string& name) {
+    std::size_t index = findSubcommand_(name.c_str());
+    if (index >= subcommands_.size()) {
+        throw AccessDeniedException(name.c_str(), "subcommand not found");
+    }
+    return subcommandArgs_(subcommands_[index]);
+}
+
+std::size_t Args::findSubcommand_(const char* name) const {
+    if (subcommandSlots_.empty()) {
+        return subcommands_.size();
+    }
+    std::size_t size = ::strlen(name);
+    std::size_t mask = subcommandSlots_.size() - 1;
+    for (std::size_t slot = tableHash(name, size, 0) & mask; subcommandSlots_[slot] != 0; slot = (slot + 1) & mask) {
+        const std::string& subcommandName = subcommands_[subcommandSlots_[slot] - 1].name;
+        if (subcommandName.size() == size && subcommandName.compare(0, size, name, size) == 0) {
+            return subcommandSlots_[slot] - 1;
+        }
+    }
+    return subcommands_.size();
+}
+
+void Args::insertSubcommand_(std::size_t index) {
+    if (subcommands_.size() * 2 > subcommandSlots_.size()) {
+        // power of 2 size for mask the hash, rebuild with all subcommands
+        std::size_t size = 16;
+        while (size < subcommands_.size() * 2) {
+            size *= 2;
+        }
+        subcommandSlots_.assign(size, 0);
+        for (std::size_t i = 0; i < index; ++i) {
+            insertSubcommand_(i);
         }
     }
-    arguments_.sort(&Argument::compareOption_);
+    const std::string& name = subcommands_[index].name;
+    std::size_t mask = subcommandSlots_.size() - 1;
+    std::size_t slot = tableHash(name.c_str(), name.size(), 0) & mask;
+    while (subcommandSlots_[slot] != 0) {
+        slot = (slot + 1) & mask;
+    }
+    subcommandSlots_[slot] = index + 1;
+}
+
+Args& Args::subcommandArgs_(Subcommand& subcommand) {
+    if (subcommand.args == NULL) {
+        Args* args = subcommand.newArgs(helpOption_ != NULL);
+        args->isAlternative_ = isAlternative_;
+        args->isStrict_ = isStrict_;
+        args->isHelpException_ = isHelpException_;
+        args->isVersionException_ = isVersionException_;
+        args->isLiteralHelp_ = isLiteralHelp_;
+        args->isAbbreviation_ = isAbbreviation_;
+        args->binaryName_ = binaryName_ + " " + subcommand.name;
+        try {
+            subcommand.buildArgs(*args, subcommand.factory);
+        }
+        catch (...) {
+            delete args;
+            throw;
+        }
+        subcommand.args = args;
+    }
+    return *subcommand.args;
+}
+
+void Args::deleteSubcommands_() {
+    for (std::size_t i = 0; i < subcommands_.size(); ++i) {
+        delete subcommands_[i].args;
+    }
+    subcommands_.clear();
+    subcommandSlots_.clear();
+    selectedSubcommand_ = 0;
+}
+
+std::size_t Args::memoryUsage() const {
+    std::size_t ret = sizeof(Args) + usageMemory_() + stringMemory(binaryName_) + stringMemory(version_) +
+                      stringsMemory(additionalArguments_);
+    for (std::size_t i = 0; i < argumentBlocks_.size(); ++i) {
+        ret += s_argumentBlockSize(i) * sizeof(Argument);
+    }
+    for (std::size_t i = 0; i < arguments_.size(); ++i) {
+        ret += arguments_[i]->memoryUsage_();
+    }
+    // color and links of each tree node
+    ret += argumentFromName_.size() * (sizeof(std::pair<const std::string, Argument*>) + 4 * sizeof(void*));
+    for (std::map<std::string, Argument*>::const_iterator it = argumentFromName_.begin();
+         it != argumentFromName_.end(); ++it) {
+        ret += stringMemory(it->first);
+    }
+    ret += elementPool_.capacity() * sizeof(ArgumentElement);
+    for (std::size_t i = 0; i < elementPool_.size(); ++i) {
+        ret += elementPool_[i].memoryUsage_();
+    }
+    ret += (arguments_.capacity() + tableArguments_.capacity() + freeArguments_.capacity() +
+            argumentFromIndex_.capacity()) *
+           sizeof(Argument*);
+    ret += snapshots_.capacity() * sizeof(Snapshot*) + argumentBlocks_.capacity() * sizeof(void*);
+    ret += freeIndexes_.capacity() * sizeof(std::size_t);
+    ret += (existBits_.capacity() + requiredBits_.capacity() + destBits_.capacity()) * sizeof(unsigned long);
+    ret += subcommands_.capacity() * sizeof(Subcommand) + subcommandSlots_.capacity() * sizeof(std::size_t);
+    for (std::size_t i = 0; i < subcommands_.size(); ++i) {
+        ret += stringMemory(subcommands_[i].name) + stringMemory(subcommands_[i].help);
+        if (subcommands_[i].args != NULL) {
+            ret += subcommands_[i].args->memoryUsage();
+        }
+    }
+    ret += sortedFlags_.capacity() * sizeof(std::pair<const char*, Argument*>);
+    ret += constraints_.capacity() * sizeof(Constraint);
+    for (std::size_t i = 0; i < constraints_.size(); ++i) {
+        ret += constraints_[i].memoryUsage();
+    }
+    return ret;
 }
 
 void Args::clear() {
     // delete all new element
-    for (std::list<Argument*>::iterator it = arguments_.begin(); it != arguments_.end(); ++it) {
-        delete (*it);
-    }
-    arguments_.clear();
+    deleteArguments_();
     argumentFromName_.clear();
+    table_ = NULL;
+    snapshot_ = NULL;
+    tableArguments_.clear();
+    for (std::size_t i = 0; i < snapshots_.size(); ++i) {
+        delete snapshots_[i];
+    }
+    snapshots_.clear();
+    elementPool_.clear();
+    constraints_.clear();
+    deleteSubcommands_();
     binaryName_ = "";
     helpOption_ = NULL;
     versionOption_ = NULL;
@@ -312,6 +913,9 @@ void Args::clear() {
     isStrict_ = false;
     isHelpException_ = false;
     isVersionException_ = false;
+    responseFile_ = ResponseFile::NONE;
+    isLiteralHelp_ = false;
+    isAbbreviation_ = false;
     additionalArguments_.clear();
     // usage
     description_ = "";
@@ -321,76 +925,150 @@ void Args::clear() {
     usageArgsWidth_ = 20;
     usageSepWidth_ = 2;
     usageHelpWidth_ = 56;
+    clearUsageCache_();
+}
+
+std::vector<std::string> Args::complete(int argc, char* argv[], int cursorIndex) {
+    const std::size_t npos = static_cast<std::size_t>(-1);
+    std::vector<std::string> candidates;
+    if (cursorIndex < 1 || cursorIndex > argc) {
+        return candidates;
+    }
+    std::string word = (cursorIndex < argc) ? argv[cursorIndex] : "";
+    Argument* argument = NULL;
+    std::size_t valueCount = 0;
+    bool hasEndOption = false;
+    for (int i = 1; i < cursorIndex && !hasEndOption; ++i) {
+        if (valueCount == npos && !endOfInfiniteArgument_(argv[i])) {
+            continue;
+        }
+        if (valueCount > 0 && valueCount != npos) {
+            --valueCount;
+            continue;
+        }
+        valueCount = 0;
+        if (isShortOption(argv[i]) || isLongOption(argv[i])) {
+            argument = completeOption_(argv[i], &valueCount);
+        }
+        else if (isEndOption(argv[i])) {
+            hasEndOption = true;
+        }
+        else {
+            std::size_t subcommandIndex = findSubcommand_(argv[i]);
+            if (subcommandIndex < subcommands_.size()) {
+                // the next words are completed by the subcommand
+                return subcommandArgs_(subcommands_[subcommandIndex]).complete(argc - i, argv + i, cursorIndex - i);
+            }
+        }
+    }
+    if (hasEndOption) {
+        return candidates;
+    }
+    if (valueCount > 0 && !(valueCount == npos && endOfInfiniteArgument_(word.c_str()))) {
+        if (argument->valid_ != NULL) {
+            argument->valid_->complete(word, &candidates);
+        }
+    }
+    else if (isLongOption(word.c_str()) && word.find('=') != std::string::npos) {
+        std::string option;
+        std::string arg;
+        takeArg(word.c_str(), &option, &arg);
+        argument = findArgument_(option);
+        if (argument != NULL && argument->valid_ != NULL) {
+            argument->valid_->complete(arg, &candidates);
+            for (std::size_t i = 0; i < candidates.size(); ++i) {
+                candidates[i].insert(0, option + "=");
+            }
+        }
+    }
+    else if (!word.empty() && word[0] == '-') {
+        // the flags which start by word follow the lower bound
+        sortFlags_();
+        std::vector<std::pair<const char*, Argument*> >::const_iterator it =
+            std::lower_bound(sortedFlags_.begin(), sortedFlags_.end(), word.c_str(), &s_compareFlag);
+        while (it != sortedFlags_.end() && ::strncmp(it->first, word.c_str(), word.size()) == 0) {
+            candidates.push_back(it->first);
+            ++it;
+        }
+    }
+    else {
+        for (std::size_t i = 0; i < subcommands_.size(); ++i) {
+            if (subcommands_[i].name.compare(0, word.size(), word) == 0) {
+                candidates.push_back(subcommands_[i].name);
+            }
+        }
+    }
+    return candidates;
 }
 
 /*
 ** private
 */
-void Args::parseShortArgument_(int maxIndex, char* argv[], int* index) {
+void Args::parseShortArgument_(int maxIndex, const Tokens& argv, int* index) {
     std::string options;
     std::string arg;
-    std::map<std::string, Argument**>::iterator it;
+    Argument* argument;
     bool hasArg = takeArg(argv[*index], &options, &arg);
     if (isAlternative_) {
         // try to find long option
-        it = argumentFromName_.find("-" + options);
-        if (it != argumentFromName_.end()) {
+        argument = findArgument_("-" + options);
+        if (argument != NULL) {
             parseArgument_(maxIndex, argv, index, hasArg, options.c_str() + ARGS_PREFIX_SIZEOF_SHORT_OPTION_,
-                           arg.c_str(), *(it->second));
+                           arg.c_str(), argument);
             return;
         }
     }
     // get firsts option
     for (std::size_t i = 1; i < options.size() - 1; ++i) {
         std::string charOption(options, i, 1);
-        it = argumentFromName_.find("-" + charOption);
-        if (it == argumentFromName_.end()) {
+        argument = findShortArgument_(options[i]);
+        if (argument == NULL) {
             throw ParseArgumentException(charOption.c_str(), "invalid option");
         }
-        else if (!hasArg && ((*(it->second))->type_ == Argument::SIMPLE_OPTION ||
-                             (*(it->second))->type_ == Argument::NUMBER_OPTION ||
-                             (*(it->second))->type_ == Argument::INFINITE_OPTION ||
-                             (*(it->second))->type_ == Argument::MULTI_OPTION ||
-                             (*(it->second))->type_ == Argument::MULTI_INFINITE_OPTION ||
-                             (*(it->second))->type_ == Argument::MULTI_NUMBER_OPTION)) {
+        else if (!hasArg && (argument->type_ == Argument::SIMPLE_OPTION || argument->type_ == Argument::NUMBER_OPTION ||
+                             argument->type_ == Argument::INFINITE_OPTION ||
+                             argument->type_ == Argument::MULTI_OPTION ||
+                             argument->type_ == Argument::MULTI_INFINITE_OPTION ||
+                             argument->type_ == Argument::MULTI_NUMBER_OPTION)) {
             hasArg = true;
             arg = options.substr(i + 1, options.size() - i);
-            (*(it->second))->isExist_ = true;
-            ++(*(it->second))->count_;
-            parseArgument_(maxIndex, argv, index, hasArg, charOption.c_str(), arg.c_str(), *(it->second));
+            setExist_(argument);
+            ++argument->count_;
+            parseArgument_(maxIndex, argv, index, hasArg, charOption.c_str(), arg.c_str(), argument);
             return;
         }
-        else if ((*(it->second))->type_ != Argument::BOOLEAN_OPTION &&
-                 (*(it->second))->type_ != Argument::REVERSE_BOOLEAN_OPTION) {
+        else if (argument->type_ != Argument::BOOLEAN_OPTION && argument->type_ != Argument::REVERSE_BOOLEAN_OPTION) {
             throw ParseArgumentException(charOption.c_str(), "only last option can be use a parameter");
         }
-        (*(it->second))->isExist_ = true;
-        ++(*(it->second))->count_;
+        setExist_(argument);
+        ++argument->count_;
     }
     // get last option
     std::string charOption(options, options.size() - 1, 1);
-    it = argumentFromName_.find("-" + charOption);
-    if (it == argumentFromName_.end()) {
+    argument = findShortArgument_(options[options.size() - 1]);
+    if (argument == NULL) {
         throw ParseArgumentException(charOption.c_str(), "invalid option");
     }
-    parseArgument_(maxIndex, argv, index, hasArg, charOption.c_str(), arg.c_str(), *(it->second));
+    parseArgument_(maxIndex, argv, index, hasArg, charOption.c_str(), arg.c_str(), argument);
 }
 
-void Args::parseLongArgument_(int maxIndex, char* argv[], int* index) {
+void Args::parseLongArgument_(int maxIndex, const Tokens& argv, int* index) {
     std::string option;
     std::string arg;
-    std::map<std::string, Argument**>::iterator it;
     bool hasArg = takeArg(argv[*index], &option, &arg);
-    it = argumentFromName_.find(option);
-    if (it == argumentFromName_.end()) {
+    Argument* argument = findArgument_(option);
+    if (argument == NULL && isAbbreviation_) {
+        argument = findAbbreviation_(option);
+    }
+    if (argument == NULL) {
         throw ParseArgumentException(option.c_str() + ARGS_PREFIX_SIZEOF_LONG_OPTION_, "invalid option");
     }
     parseArgument_(maxIndex, argv, index, hasArg, option.c_str() + ARGS_PREFIX_SIZEOF_LONG_OPTION_, arg.c_str(),
-                   *(it->second));
+                   argument);
 }
 
-void Args::parseArgument_(int maxIndex, char* argv[], int* index, bool hasArg, const char* option, const char* arg,
-                          Argument* argument) {
+void Args::parseArgument_(int maxIndex, const Tokens& argv, int* index, bool hasArg, const char* option,
+                          const char* arg, Argument* argument) {
     if (hasArg) {
         switch (argument->type_) {
             case Argument::SIMPLE_OPTION:
@@ -402,16 +1080,16 @@ void Args::parseArgument_(int maxIndex, char* argv[], int* index, bool hasArg, c
                 throw ParseArgumentException(option, "option cannot use with only 1 argument");
                 break;
             case Argument::INFINITE_OPTION: {
-                argument->clear();
-                argument->push_back(arg);
+                recycleElements_(*argument);
+                pushValue_(argument, arg);
                 break;
             }
             case Argument::MULTI_OPTION:
             case Argument::MULTI_INFINITE_OPTION: {
                 if (argument->isExist_ == false) {
-                    argument->clear();
+                    recycleElements_(*argument);
                 }
-                argument->push_back(arg);
+                pushValue_(argument, arg);
                 break;
             }
             default:
@@ -429,23 +1107,23 @@ void Args::parseArgument_(int maxIndex, char* argv[], int* index, bool hasArg, c
                 argument->argument_ = argv[*index];
                 break;
             case Argument::NUMBER_OPTION:
-                argument->clear();
+                recycleElements_(*argument);
                 if (*index + argument->nargs_ >= static_cast<unsigned int>(maxIndex)) {
                     throw ParseArgumentException(option, "bad number of argument");
                 }
                 for (unsigned int i = *index + 1; i <= (*index + argument->nargs_); ++i) {
-                    argument->push_back(argv[i]);
+                    newElement_(*argument, argv[i]);
                 }
                 *index += argument->nargs_;
                 break;
             case Argument::INFINITE_OPTION: {
-                argument->clear();
+                recycleElements_(*argument);
                 std::size_t countArg = 0;
                 for (int i = *index + 1; i < maxIndex; ++i) {
                     if (endOfInfiniteArgument_(argv[i])) {
                         break;
                     }
-                    argument->push_back(argv[i]);
+                    pushValue_(argument, argv[i]);
                     ++countArg;
                 }
                 *index += countArg;
@@ -453,25 +1131,25 @@ void Args::parseArgument_(int maxIndex, char* argv[], int* index, bool hasArg, c
             }
             case Argument::MULTI_OPTION: {
                 if (argument->isExist_ == false) {
-                    argument->clear();
+                    recycleElements_(*argument);
                 }
                 if (*index + 1 >= maxIndex) {
                     throw ParseArgumentException(option, "bad number of argument");
                 }
                 ++(*index);
-                argument->push_back(argv[*index]);
+                pushValue_(argument, argv[*index]);
                 break;
             }
             case Argument::MULTI_INFINITE_OPTION: {
                 if (argument->isExist_ == false) {
-                    argument->clear();
+                    recycleElements_(*argument);
                 }
                 std::size_t countArg = 0;
                 for (int i = *index + 1; i < maxIndex; ++i) {
                     if (endOfInfiniteArgument_(argv[i])) {
                         break;
                     }
-                    argument->push_back(argv[i]);
+                    pushValue_(argument, argv[i]);
                     ++countArg;
                 }
                 *index += countArg;
@@ -479,22 +1157,22 @@ void Args::parseArgument_(int maxIndex, char* argv[], int* index, bool hasArg, c
             }
             case Argument::MULTI_NUMBER_OPTION: {
                 if (argument->isExist_ == false) {
-                    argument->clear();
+                    recycleElements_(*argument);
                 }
                 if (*index + argument->nargs_ >= static_cast<unsigned int>(maxIndex)) {
                     throw ParseArgumentException(option, "bad number of argument");
                 }
-                ArgumentElement newNumberArgument;
+                ArgumentElement& newNumberArgument = newElement_(*argument);
+                newNumberArgument.reserve(argument->nargs_);
                 for (unsigned int i = *index + 1; i <= *index + argument->nargs_; ++i) {
-                    newNumberArgument.push_back(argv[i]);
+                    newElement_(newNumberArgument, argv[i]);
                 }
-                argument->push_back(newNumberArgument);
                 *index += argument->nargs_;
                 break;
             }
             case Argument::MULTI_NUMBER_INFINITE_OPTION: {
                 if (argument->isExist_ == false) {
-                    argument->clear();
+                    recycleElements_(*argument);
                 }
                 std::size_t countArg = 0;
                 for (int i = *index + 1; i < maxIndex; i += argument->nargs_) {
@@ -504,12 +1182,12 @@ void Args::parseArgument_(int maxIndex, char* argv[], int* index, bool hasArg, c
                     if (i + argument->nargs_ > static_cast<unsigned int>(maxIndex)) {
                         throw ParseArgumentException(option, "bad number of argument");
                     }
-                    ArgumentElement newNumberArgument;
+                    ArgumentElement& newNumberArgument = newElement_(*argument);
+                    newNumberArgument.reserve(argument->nargs_);
                     for (unsigned int j = i; j < i + argument->nargs_; ++j) {
-                        newNumberArgument.push_back(argv[j]);
+                        newElement_(newNumberArgument, argv[j]);
                         ++countArg;
                     }
-                    argument->push_back(newNumberArgument);
                 }
                 *index += countArg;
                 break;
@@ -518,62 +1196,259 @@ void Args::parseArgument_(int maxIndex, char* argv[], int* index, bool hasArg, c
                 break;
         }
     }
-    argument->isExist_ = true;
+    setExist_(argument);
     ++argument->count_;
 }
 
+void Args::dropIndex_() {
+    // names and flags of table or snapshot are only in its index
+    if (table_ != NULL || snapshot_ != NULL) {
+        for (std::size_t i = 0; i < tableArguments_.size(); ++i) {
+            const std::vector<std::string>& nameOrFlags = tableArguments_[i]->nameOrFlags_;
+            for (std::size_t j = 0; j < nameOrFlags.size(); ++j) {
+                argumentFromName_.insert(std::pair<std::string, Argument*>(nameOrFlags[j], tableArguments_[i]));
+            }
+        }
+    }
+    table_ = NULL;
+    snapshot_ = NULL;
+    tableArguments_.clear();
+}
+
+Argument* Args::findArgument_(const std::string& nameOrFlag) const {
+    if (table_ != NULL) {
+        const TableSlot* slot = tableFind(*table_, nameOrFlag.c_str(), nameOrFlag.size());
+        if (slot != NULL) {
+            return tableArguments_[slot->argument];
+        }
+    }
+    else if (snapshot_ != NULL) {
+        std::size_t index = snapshot_->find(nameOrFlag.c_str(), nameOrFlag.size());
+        if (index != static_cast<std::size_t>(-1)) {
+            return tableArguments_[index];
+        }
+    }
+    std::map<std::string, Argument*>::const_iterator it = argumentFromName_.find(nameOrFlag);
+    if (it == argumentFromName_.end()) {
+        return NULL;
+    }
+    return it->second;
+}
+
+Argument* Args::completeOption_(const char* token, std::size_t* valueCount) {
+    std::string option;
+    std::string arg;
+    bool hasArg = takeArg(token, &option, &arg);
+    Argument* argument = NULL;
+    if (isLongOption(token)) {
+        argument = findArgument_(option);
+        if (argument == NULL && isAbbreviation_) {
+            try {
+                argument = findAbbreviation_(option);
+            }
+            catch (const ParseArgumentException&) {
+                // ambiguous option waits nothing
+            }
+        }
+    }
+    else {
+        if (isAlternative_) {
+            argument = findArgument_("-" + option);
+        }
+        // the first option which waits values takes the end of token
+        for (std::size_t i = 1; argument == NULL && i < option.size(); ++i) {
+            argument = findShortArgument_(option[i]);
+            if (argument != NULL && argument->nargs_ == 0) {
+                argument = NULL;
+            }
+            else if (argument != NULL && i + 1 < option.size()) {
+                hasArg = true;
+            }
+        }
+    }
+    *valueCount = 0;
+    if (argument != NULL && !hasArg) {
+        switch (argument->type_) {
+            case Argument::SIMPLE_OPTION:
+            case Argument::NUMBER_OPTION:
+            case Argument::MULTI_OPTION:
+            case Argument::MULTI_NUMBER_OPTION:
+                *valueCount = argument->nargs_;
+                break;
+            case Argument::INFINITE_OPTION:
+            case Argument::MULTI_INFINITE_OPTION:
+            case Argument::MULTI_NUMBER_INFINITE_OPTION:
+                *valueCount = static_cast<std::size_t>(-1);
+                break;
+            default:
+                break;
+        }
+    }
+    return argument;
+}
+
+void Args::sortFlags_() const {
+    if (hasSortedFlags_) {
+        return;
+    }
+    sortedFlags_.clear();
+    for (std::size_t i = 0; i < arguments_.size(); ++i) {
+        if (arguments_[i]->isPositionnalArgument_()) {
+            continue;
+        }
+        const std::vector<std::string>& nameOrFlags = arguments_[i]->nameOrFlags_;
+        for (std::size_t j = 0; j < nameOrFlags.size(); ++j) {
+            sortedFlags_.push_back(std::pair<const char*, Argument*>(nameOrFlags[j].c_str(), arguments_[i]));
+        }
+    }
+    std::sort(sortedFlags_.begin(), sortedFlags_.end(), &s_compareFlags);
+    hasSortedFlags_ = true;
+}
+
+Argument* Args::findAbbreviation_(const std::string& prefix) const {
+    sortFlags_();
+    std::vector<std::pair<const char*, Argument*> >::const_iterator first =
+        std::lower_bound(sortedFlags_.begin(), sortedFlags_.end(), prefix.c_str(), &s_compareFlag);
+    std::vector<std::pair<const char*, Argument*> >::const_iterator it = first;
+    // the options which start by prefix follow the first
+    while (it != sortedFlags_.end() && ::strncmp(it->first, prefix.c_str(), prefix.size()) == 0) {
+        if (it->second != first->second) {
+            std::string message("ambiguous option could match ");
+            for (it = first; it != sortedFlags_.end() && ::strncmp(it->first, prefix.c_str(), prefix.size()) == 0;
+                 ++it) {
+                if (it != first) {
+                    message += ", ";
+                }
+                message += it->first;
+            }
+            throw ParseArgumentException(prefix.c_str() + ARGS_PREFIX_SIZEOF_LONG_OPTION_, message.c_str());
+        }
+        ++it;
+    }
+    if (it == first) {
+        return NULL;
+    }
+    return first->second;
+}
+
+Argument* Args::findShortArgument_(char option) const {
+    if (table_ != NULL && static_cast<unsigned char>(option) < 128) {
+        std::size_t shortOption = table_->shortOptions[static_cast<unsigned char>(option)];
+        if (shortOption != 0) {
+            return tableArguments_[shortOption - 1];
+        }
+    }
+    else if (snapshot_ != NULL) {
+        std::size_t index = snapshot_->findShort(option);
+        if (index != static_cast<std::size_t>(-1)) {
+            return tableArguments_[index];
+        }
+    }
+    const char flag[] = {'-', option, '\0'};
+    std::map<std::string, Argument*>::const_iterator it = argumentFromName_.find(flag);
+    if (it == argumentFromName_.end()) {
+        return NULL;
+    }
+    return it->second;
+}
+
 bool Args::endOfInfiniteArgument_(const char* argument) {
     std::string option;
     std::string arg;
-    std::map<std::string, Argument**>::iterator it;
+    Argument* found;
     if (isShortOption(argument)) {
         bool hasArg = takeArg(argument, &option, &arg);
         if (isAlternative_) {
-            it = argumentFromName_.find("-" + option);
-            if (it != argumentFromName_.end()) {
+            if (findArgument_("-" + option) != NULL) {
                 return true;
             }
         }
         // get firsts option
         for (std::size_t i = 1; i < option.size() - 1; ++i) {
-            std::string charOption(option, i, 1);
-            it = argumentFromName_.find("-" + charOption);
-            if (it == argumentFromName_.end()) {
+            found = findShortArgument_(option[i]);
+            if (found == NULL) {
                 return false;
             }
-            else if (!hasArg && ((*(it->second))->type_ == Argument::SIMPLE_OPTION ||
-                                 (*(it->second))->type_ == Argument::NUMBER_OPTION ||
-                                 (*(it->second))->type_ == Argument::INFINITE_OPTION ||
-                                 (*(it->second))->type_ == Argument::MULTI_OPTION ||
-                                 (*(it->second))->type_ == Argument::MULTI_INFINITE_OPTION ||
-                                 (*(it->second))->type_ == Argument::MULTI_NUMBER_OPTION)) {
+            else if (!hasArg && (found->type_ == Argument::SIMPLE_OPTION || found->type_ == Argument::NUMBER_OPTION ||
+                                 found->type_ == Argument::INFINITE_OPTION || found->type_ == Argument::MULTI_OPTION ||
+                                 found->type_ == Argument::MULTI_INFINITE_OPTION ||
+                                 found->type_ == Argument::MULTI_NUMBER_OPTION)) {
                 return true;
             }
-            else if ((*(it->second))->type_ == Argument::BOOLEAN_OPTION ||
-                     (*(it->second))->type_ == Argument::REVERSE_BOOLEAN_OPTION) {
+            else if (found->type_ == Argument::BOOLEAN_OPTION || found->type_ == Argument::REVERSE_BOOLEAN_OPTION) {
                 return true;
             }
         }
         // get last option
-        std::string charOption(option, option.size() - 1, 1);
-        it = argumentFromName_.find("-" + charOption);
+        found = findShortArgument_(option[option.size() - 1]);
     }
     else if (isLongOption(argument)) {
         takeArg(argument, &option, &arg);
-        it = argumentFromName_.find(option);
+        found = findArgument_(option);
+        if (found == NULL && isAbbreviation_) {
+            try {
+                found = findAbbreviation_(option);
+            }
+            catch (const ParseArgumentException&) {
+                // an ambiguous prefix is an option, its parse throws
+                return true;
+            }
+        }
     }
     else {
         return false;
     }
-    if (it == argumentFromName_.end()) {
-        return false;
+    return found != NULL;
+}
+
+void Args::pushValue_(Argument* argument, const char* value) {
+    if (argument->inputFd_ == -1 || value[0] != '-' || value[1] != '\0') {
+        streamValue_(argument, value);
+        return;
+    }
+    try {
+        InputReader reader(argument->inputFd_, argument->inputDelimiter_);
+        const char* input;
+        while ((input = reader.next()) != NULL) {
+            streamValue_(argument, input);
+        }
+    }
+    catch (const ParseArgumentValidException&) {
+        throw;
+    }
+    catch (const ParseArgumentException& e) {
+        // add name or first flag in exception
+        throw ParseArgumentException(argument->nameOrFlags_.front().c_str(), e.what());
+    }
+}
+
+void Args::streamValue_(Argument* argument, const char* value) {
+    if (!argument->isStream_) {
+        newElement_(*argument, value);
+        return;
+    }
+    if (argument->valid_ != NULL) {
+        // the valid interface can transform the value
+        std::vector<std::string> arguments(1, value);
+        try {
+            if (argument->valid_->isValid(arguments) == false || arguments.empty()) {
+                throw ParseArgumentValidException("invalid check function");
+            }
+        }
+        catch (const ParseArgumentValidException& e) {
+            // add name or first flag in exception
+            throw ParseArgumentValidException(argument->nameOrFlags_.front().c_str(), e.what());
+        }
+        argument->toStream_(arguments.front().c_str());
+    }
+    else {
+        argument->toStream_(value);
     }
-    return true;
 }
 
-void Args::parsePositionnalArgument_(int argc, char* argv[], int* index, bool hasEndOption) {
+void Args::parsePositionnalArgument_(int argc, const Tokens& argv, int* index, bool hasEndOption) {
     // find not exists positionnal argument
-    std::list<Argument*>::iterator it;
+    std::vector<Argument*>::iterator it;
     for (it = arguments_.begin(); it != arguments_.end(); ++it) {
         if ((*it)->isExist_ == false && (*it)->isPositionnalArgument_()) {
             break;
@@ -589,7 +1464,7 @@ void Args::parsePositionnalArgument_(int argc, char* argv[], int* index, bool ha
                 throw ParseArgumentException(argument.nameOrFlags_.front().c_str(), "bad number of argument");
             }
             for (unsigned int i = *index; i < (*index + argument.nargs_); ++i) {
-                argument.push_back(argv[i]);
+                newElement_(argument, argv[i]);
             }
             *index += argument.nargs_ - 1;
         }
@@ -599,7 +1474,7 @@ void Args::parsePositionnalArgument_(int argc, char* argv[], int* index, bool ha
                 if (!hasEndOption && endOfInfiniteArgument_(argv[i])) {
                     break;
                 }
-                (*it)->push_back(argv[i]);
+                pushValue_(*it, argv[i]);
                 ++countArg;
             }
             *index += countArg - 1;
@@ -613,16 +1488,16 @@ void Args::parsePositionnalArgument_(int argc, char* argv[], int* index, bool ha
                 if (i + argument.nargs_ > static_cast<unsigned int>(argc)) {
                     throw ParseArgumentException(argument.nameOrFlags_.front().c_str(), "bad number of argument");
                 }
-                ArgumentElement newNumberArgument;
+                ArgumentElement& newNumberArgument = newElement_(argument);
+                newNumberArgument.reserve(argument.nargs_);
                 for (unsigned int j = i; j < i + argument.nargs_; ++j) {
-                    newNumberArgument.push_back(argv[j]);
+                    newElement_(newNumberArgument, argv[j]);
                     ++countArg;
                 }
-                argument.push_back(newNumberArgument);
             }
             *index += countArg - 1;
         }
-        argument.isExist_ = true;
+        setExist_(&argument);
     }
     else {
         if (isStrict_) {
@@ -26,7 +26,7 @@
 #include "blet/args/argument.h"
 
 #include <algorithm>
-#include <sstream>
+#include <cstdlib> // strtod
 
 #include "blet/args/action.h"
 #include "blet/args/args.h"
@@ -39,6 +39,63 @@ namespace blet {
 
 namespace args {
 
+static inline bool s_isDigit(char c) {
+    return c >= '0' && c <= '9';
+}
+
+/**
+ * @brief Convert str to a decimal number without stream, the whole string is the number
+ *
+ * @param str
+ * @param number result or 0 if str is not a number
+ * @return [true] if str is a decimal number
+ */
+static inline bool s_toNumber(const std::string& str, double* number) {
+    const char* it = str.c_str();
+    *number = 0.0;
+    // skip the leading spaces like a stream
+    while (*it == ' ' || *it == '\t' || *it == '\n' || *it == '\r' || *it == '\v' || *it == '\f') {
+        ++it;
+    }
+    const char* begin = it;
+    if (*it == '+' || *it == '-') {
+        ++it;
+    }
+    std::size_t digitCount = 0;
+    while (s_isDigit(*it)) {
+        ++it;
+        ++digitCount;
+    }
+    if (*it == '.') {
+        ++it;
+        while (s_isDigit(*it)) {
+            ++it;
+            ++digitCount;
+        }
+    }
+    if (digitCount == 0) {
+        return false;
+    }
+    if (*it == 'e' || *it == 'E') {
+        ++it;
+        if (*it == '+' || *it == '-') {
+            ++it;
+        }
+        if (!s_isDigit(*it)) {
+            return false;
+        }
+        while (s_isDigit(*it)) {
+            ++it;
+        }
+    }
+    // no hexadecimal, nan, inf or characters after the number
+    if (it != str.c_str() + str.size()) {
+        return false;
+    }
+    *number = ::strtod(begin, NULL);
+    return true;
+}
+
 static inline bool compareFlag(const std::string& first, const std::string& second) {
     if (isShortOption(first.c_str()) && isShortOption(second.c_str())) {
         return first < second;
@@ -62,30 +119,60 @@ static inline bool compareFlag(const std::string& first, const std::string& seco
 
 ArgumentElement::ArgumentElement() :
     std::vector<ArgumentElement>(),
-    argument_(),
-    default_(),
-    isNumber_(false),
-    number_(0.0) {}
+    argument_() {}
 ArgumentElement::ArgumentElement(const ArgumentElement& rhs) :
     std::vector<ArgumentElement>(rhs),
-    argument_(rhs.argument_),
-    default_(rhs.default_),
-    isNumber_(rhs.isNumber_),
-    number_(rhs.number_) {}
-ArgumentElement::ArgumentElement(const char* arg__, const char* default__) :
-    std::vector<ArgumentElement>(),
-    argument_(arg__),
-    default_(default__),
-    isNumber_(false),
-    number_(0.0) {}
+    argument_(rhs.argument_) {}
 ArgumentElement::ArgumentElement(const char* arg) :
     std::vector<ArgumentElement>(),
-    argument_(arg),
-    default_(),
-    isNumber_(false),
-    number_(0.0) {}
+    argument_(arg) {}
 ArgumentElement::~ArgumentElement() {}
 
+ArgumentElement& ArgumentElement::operator=(const ArgumentElement& rhs) {
+    std::vector<ArgumentElement>::operator=(rhs);
+    argument_ = rhs.argument_;
+    return *this;
+}
+
+#if __cplusplus >= 201103L
+ArgumentElement::ArgumentElement(ArgumentElement&& rhs) noexcept :
+    std::vector<ArgumentElement>(std::move(rhs)),
+    argument_(std::move(rhs.argument_)) {}
+
+ArgumentElement& ArgumentElement::operator=(ArgumentElement&& rhs) noexcept {
+    std::vector<ArgumentElement>::operator=(std::move(rhs));
+    argument_ = std::move(rhs.argument_);
+    return *this;
+}
+#endif
+
+void ArgumentElement::swap_(ArgumentElement& rhs) {
+    std::vector<ArgumentElement>::swap(rhs);
+    argument_.swap(rhs.argument_);
+}
+
+std::size_t ArgumentElement::memoryUsage_() const {
+    std::size_t ret = capacity() * sizeof(ArgumentElement) + stringMemory(argument_);
+    for (std::size_t i = 0; i < size(); ++i) {
+        ret += at(i).memoryUsage_();
+    }
+    return ret;
+}
+
+bool ArgumentElement::isNumber() const {
+    double number;
+    // a group of values is never a number
+    return empty() && s_toNumber(argument_, &number);
+}
+
+double ArgumentElement::getNumber() const {
+    double number;
+    if (empty() && s_toNumber(argument_, &number)) {
+        return number;
+    }
+    throw Exception("is not a number");
+}
+
 ArgumentElement::operator std::vector<std::string>() const {
     if (!empty() && front().empty()) {
         std::vector<std::string> ret;
@@ -107,35 +194,102 @@ Argument::Argument(Args& args) :
     ArgumentElement(),
     args_(args),
     nameOrFlags_(),
-    type_(SIMPLE_OPTION),
-    isExist_(false),
-    isRequired_(false),
+    defaults_(),
+    default_(),
     count_(0),
     nargs_(1),
+    index_(0),
     help_(),
     metavar_(),
+    helpLiteral_(NULL),
+    metavarLiteral_(NULL),
+    helpFunction_(NULL),
+    group_(),
     valid_(NULL),
-    validDeletable_(true),
-    this_(NULL),
+    dest_(NULL),
+    destCustom_(NULL),
+    destFunction_(NULL),
+    streamFunction_(NULL),
+    stringCache_(),
+    type_(SIMPLE_OPTION),
     action_(Action::NONE),
-    defaults_() {}
+    inputFd_(-1),
+    generation_(0),
+    inputDelimiter_('\0'),
+    isExist_(false),
+    isRequired_(false),
+    validDeletable_(true),
+    isStream_(false),
+    hasStringCache_(false) {}
 
 Argument::Argument(const Argument& rhs) :
     ArgumentElement(rhs),
     args_(rhs.args_),
     nameOrFlags_(rhs.nameOrFlags_),
-    type_(rhs.type_),
-    isExist_(rhs.isExist_),
-    isRequired_(rhs.isRequired_),
+    defaults_(),
+    default_(rhs.default_),
     count_(rhs.count_),
     nargs_(rhs.nargs_),
+    index_(rhs.index_),
     help_(rhs.help_),
     metavar_(rhs.metavar_),
+    helpLiteral_(rhs.helpLiteral_),
+    metavarLiteral_(rhs.metavarLiteral_),
+    helpFunction_(rhs.helpFunction_),
+    group_(rhs.group_),
     valid_(rhs.valid_),
+    dest_(rhs.dest_),
+    destCustom_(rhs.destCustom_),
+    destFunction_(rhs.destFunction_),
+    streamFunction_(rhs.streamFunction_),
+    stringCache_(rhs.stringCache_),
+    type_(rhs.type_),
+    action_(rhs.action_),
+    inputFd_(rhs.inputFd_),
+    generation_(rhs.generation_),
+    inputDelimiter_(rhs.inputDelimiter_),
+    isExist_(rhs.isExist_),
+    isRequired_(rhs.isRequired_),
     validDeletable_(rhs.validDeletable_),
-    this_(rhs.this_),
+    isStream_(rhs.isStream_),
+    hasStringCache_(rhs.hasStringCache_) {}
+
+#if __cplusplus >= 201103L
+Argument::Argument(Argument&& rhs) noexcept :
+    ArgumentElement(std::move(rhs)),
+    args_(rhs.args_),
+    nameOrFlags_(std::move(rhs.nameOrFlags_)),
+    defaults_(std::move(rhs.defaults_)),
+    default_(std::move(rhs.default_)),
+    count_(rhs.count_),
+    nargs_(rhs.nargs_),
+    index_(rhs.index_),
+    help_(std::move(rhs.help_)),
+    metavar_(std::move(rhs.metavar_)),
+    helpLiteral_(rhs.helpLiteral_),
+    metavarLiteral_(rhs.metavarLiteral_),
+    helpFunction_(rhs.helpFunction_),
+    group_(std::move(rhs.group_)),
+    valid_(rhs.valid_),
+    dest_(rhs.dest_),
+    destCustom_(rhs.destCustom_),
+    destFunction_(rhs.destFunction_),
+    streamFunction_(rhs.streamFunction_),
+    stringCache_(std::move(rhs.stringCache_)),
+    type_(rhs.type_),
     action_(rhs.action_),
-    defaults_() {}
+    inputFd_(rhs.inputFd_),
+    generation_(rhs.generation_),
+    inputDelimiter_(rhs.inputDelimiter_),
+    isExist_(rhs.isExist_),
+    isRequired_(rhs.isRequired_),
+    validDeletable_(rhs.validDeletable_),
+    isStream_(rhs.isStream_),
+    hasStringCache_(rhs.hasStringCache_) {
+    // the validator is owned by this object
+    rhs.validDeletable_ = false;
+}
+#endif
 
 Argument::~Argument() {
     if (valid_ != NULL && validDeletable_) {
@@ -143,42 +297,93 @@ Argument::~Argument() {
     }
 }
 
-std::string Argument::getString() const {
-    std::string ret("");
+const std::string& Argument::getString() const {
+    if (hasStringCache_) {
+        return stringCache_;
+    }
     if (type_ == BOOLEAN_OPTION) {
-        ret = (isExist_) ? "true" : "false";
+        stringCache_ = (isExist_) ? "true" : "false";
     }
     else if (type_ == REVERSE_BOOLEAN_OPTION) {
-        ret = (isExist_) ? "false" : "true";
+        stringCache_ = (isExist_) ? "false" : "true";
     }
-    else {
-        std::ostringstream oss("");
-        if (!empty()) {
-            for (std::size_t i = 0; i < size(); ++i) {
-                if (i > 0) {
-                    oss << ", ";
-                }
-                if (!at(i).empty()) {
-                    oss << "(";
-                    for (std::size_t j = 0; j < at(i).size(); ++j) {
-                        if (j > 0) {
-                            oss << ", ";
-                        }
-                        oss << at(i).at(j).argument_;
+    else if (!empty()) {
+        // compute the size before append for only one allocation
+        std::size_t length = 0;
+        for (std::size_t i = 0; i < size(); ++i) {
+            if (i > 0) {
+                length += sizeof(", ") - 1;
+            }
+            if (!at(i).empty()) {
+                length += sizeof("()") - 1;
+                for (std::size_t j = 0; j < at(i).size(); ++j) {
+                    if (j > 0) {
+                        length += sizeof(", ") - 1;
                     }
-                    oss << ")";
-                }
-                else {
-                    oss << at(i).argument_;
+                    length += at(i).at(j).argument_.size();
                 }
             }
+            else {
+                length += at(i).argument_.size();
+            }
         }
-        else {
-            oss << argument_;
+        stringCache_.clear();
+        stringCache_.reserve(length);
+        for (std::size_t i = 0; i < size(); ++i) {
+            if (i > 0) {
+                stringCache_.append(", ", sizeof(", ") - 1);
+            }
+            if (!at(i).empty()) {
+                stringCache_ += '(';
+                for (std::size_t j = 0; j < at(i).size(); ++j) {
+                    if (j > 0) {
+                        stringCache_.append(", ", sizeof(", ") - 1);
+                    }
+                    stringCache_ += at(i).at(j).argument_;
+                }
+                stringCache_ += ')';
+            }
+            else {
+                stringCache_ += at(i).argument_;
+            }
         }
-        ret = oss.str();
     }
-    return ret;
+    else {
+        stringCache_ = argument_;
+    }
+    hasStringCache_ = true;
+    return stringCache_;
+}
+
+ValueRange Argument::values() const {
+    switch (type_) {
+        case POSITIONAL_ARGUMENT:
+        case SIMPLE_OPTION:
+            return ValueRange(ValueIterator(this, 0, true), ValueIterator(this, 1, true));
+        case NUMBER_POSITIONAL_ARGUMENT:
+        case INFINITE_POSITIONAL_ARGUMENT:
+        case NUMBER_OPTION:
+        case MULTI_OPTION:
+        case INFINITE_OPTION:
+        case MULTI_INFINITE_OPTION:
+        case MULTI_NUMBER_OPTION:
+        case MULTI_NUMBER_INFINITE_OPTION:
+        case INFINITE_NUMBER_POSITIONAL_ARGUMENT:
+            return ValueRange(ValueIterator(this, 0, false), ValueIterator(this, size(), false));
+        default:
+            throw Exception("values not authorized");
+    }
+}
+
+GroupRange Argument::groups() const {
+    switch (type_) {
+        case MULTI_NUMBER_OPTION:
+        case MULTI_NUMBER_INFINITE_OPTION:
+        case INFINITE_NUMBER_POSITIONAL_ARGUMENT:
+            return GroupRange(GroupIterator(this, 0), GroupIterator(this, size()));
+        default:
+            throw Exception("groups not authorized");
+    }
 }
 
 Argument::operator std::vector<std::string>() const {
@@ -244,8 +449,9 @@ Argument& Argument::flag(const char* flag__) {
     }
     nameOrFlags_.push_back(flag__);
     sortNameOrFlags_();
-    args_.argumentFromName_.insert(std::pair<std::string, Argument**>(flag__, this_));
-    args_.arguments_.sort(&Argument::compareOption_);
+    args_.clearUsageCache_();
+    args_.argumentFromName_.insert(std::pair<std::string, Argument*>(flag__, this));
+    args_.sortArguments_();
     return *this;
 }
 
@@ -264,9 +470,71 @@ Argument& Argument::action(enum Action::eAction action__) {
     return *this;
 }
 
+const std::string& Argument::getHelp() const {
+    if (helpFunction_ != NULL) {
+        help_ = helpFunction_();
+    }
+    else if (helpLiteral_ != NULL) {
+        help_ = helpLiteral_;
+        helpLiteral_ = NULL;
+    }
+    return help_;
+}
+
+const std::string& Argument::getMetavar() const {
+    if (metavarLiteral_ != NULL) {
+        metavar_ = metavarLiteral_;
+        metavarLiteral_ = NULL;
+    }
+    return metavar_;
+}
+
+Argument& Argument::help(const char* help__) {
+    if (args_.isLiteralHelp_) {
+        help_.clear();
+        helpLiteral_ = help__;
+    }
+    else {
+        help_ = help__;
+        helpLiteral_ = NULL;
+    }
+    helpFunction_ = NULL;
+    args_.clearUsageCache_();
+    return *this;
+}
+
+Argument& Argument::help(std::string (*getHelp)()) {
+    help_.clear();
+    helpLiteral_ = NULL;
+    helpFunction_ = getHelp;
+    args_.clearUsageCache_();
+    return *this;
+}
+
 Argument& Argument::required(bool required__) {
     isRequired_ = required__;
-    args_.arguments_.sort(&Argument::compareOption_);
+    Args::setBit_(args_.requiredBits_, index_, required__);
+    args_.sortArguments_();
+    args_.clearUsageCache_();
+    return *this;
+}
+
+Argument& Argument::metavar(const char* metavar__) {
+    if (args_.isLiteralHelp_) {
+        metavar_.clear();
+        metavarLiteral_ = metavar__;
+    }
+    else {
+        metavar_ = metavar__;
+        metavarLiteral_ = NULL;
+    }
+    args_.clearUsageCache_();
+    return *this;
+}
+
+Argument& Argument::group(const char* group__) {
+    group_ = group__;
+    args_.clearUsageCache_();
     return *this;
 }
 
@@ -358,32 +626,6 @@ bool Argument::compareOption_(const Argument* first, const Argument* second) {
     }
 }
 
-void Argument::toNumber_() {
-    if (type_ == BOOLEAN_OPTION || type_ == REVERSE_BOOLEAN_OPTION) {
-        return;
-    }
-    else {
-        if (!empty()) {
-            for (std::size_t i = 0; i < size(); ++i) {
-                if (!at(i).empty()) {
-                    for (std::size_t j = 0; j < at(i).size(); ++j) {
-                        std::stringstream ss(at(i).at(j).argument_);
-                        at(i).at(j).isNumber_ = static_cast<bool>(ss >> at(i).at(j).number_);
-                    }
-                }
-                else {
-                    std::stringstream ss(at(i).argument_);
-                    at(i).isNumber_ = static_cast<bool>(ss >> at(i).number_);
-                }
-            }
-        }
-        else {
-            std::stringstream ss(argument_);
-            isNumber_ = static_cast<bool>(ss >> number_);
-        }
-    }
-}
-
 std::string Argument::metavarDefault_() {
     const char* flag = NULL;
     // get short or long name
@@ -421,6 +663,8 @@ std::string Argument::metavarDefault_() {
 }
 
 void Argument::typeConstructor_() {
+    hasStringCache_ = false;
+    args_.clearUsageCache_();
     if (isPositionnalArgument_()) {
         if (nargs_ == 1 && action_ == Action::NONE) {
             type_ = Argument::POSITIONAL_ARGUMENT;
@@ -502,86 +746,142 @@ void Argument::typeConstructor_() {
 }
 
 void Argument::defaultsConstructor_() {
+    hasStringCache_ = false;
+    args_.clearUsageCache_();
     // default arguments
     if (nargs_ > 0 && defaults_.size() > 0) {
-        clear();
-        if (type_ == Argument::POSITIONAL_ARGUMENT || type_ == Argument::SIMPLE_OPTION) {
+        if (type_ == Argument::POSITIONAL_ARGUMENT || type_ == Argument::SIMPLE_OPTION ||
+            type_ == Argument::NUMBER_POSITIONAL_ARGUMENT || type_ == Argument::NUMBER_OPTION) {
             if (defaults_.size() != nargs_) {
                 throw ArgumentException(nameOrFlags_.front().c_str(),
                                         "invalid number of argument with number of default argument");
             }
+        }
+        if (type_ == Argument::POSITIONAL_ARGUMENT || type_ == Argument::SIMPLE_OPTION) {
             argument_ = defaults_.front();
-            default_ = defaults_.front();
         }
-        if (type_ == Argument::NUMBER_POSITIONAL_ARGUMENT || type_ == Argument::NUMBER_OPTION) {
-            if (defaults_.size() != nargs_) {
+        if (type_ == Argument::INFINITE_NUMBER_POSITIONAL_ARGUMENT || type_ == Argument::MULTI_NUMBER_OPTION ||
+            type_ == Argument::MULTI_NUMBER_INFINITE_OPTION) {
+            if (defaults_.size() % nargs_ != 0) {
                 throw ArgumentException(nameOrFlags_.front().c_str(),
                                         "invalid number of argument with number of default argument");
             }
-            default_ = "";
+        }
+        resetElements_();
+    }
+    default_.clear();
+    defaultTo_(default_);
+}
+
+void Argument::clear_() {
+    hasStringCache_ = false;
+    argument_ = default_;
+    count_ = 0;
+    isExist_ = false;
+    resetElements_();
+}
+
+void Argument::resetElements_() {
+    // keep the storage of the previous parse in the pool of args
+    args_.recycleElements_(*this);
+    if (nargs_ == 0 || defaults_.empty()) {
+        return;
+    }
+    switch (type_) {
+        case NUMBER_POSITIONAL_ARGUMENT:
+        case NUMBER_OPTION:
+        case INFINITE_POSITIONAL_ARGUMENT:
+        case MULTI_OPTION:
+        case INFINITE_OPTION:
+        case MULTI_INFINITE_OPTION:
             for (std::size_t i = 0; i < defaults_.size(); ++i) {
-                if (i > 0) {
-                    default_ += ", ";
+                args_.newElement_(*this, defaults_[i].c_str());
+            }
+            break;
+        case INFINITE_NUMBER_POSITIONAL_ARGUMENT:
+        case MULTI_NUMBER_OPTION:
+        case MULTI_NUMBER_INFINITE_OPTION:
+            for (std::size_t i = 0; i < defaults_.size() / nargs_; ++i) {
+                ArgumentElement& numberElement = args_.newElement_(*this);
+                for (std::size_t j = 0; j < nargs_; ++j) {
+                    if (j > 0) {
+                        numberElement.argument_ += ", ";
+                    }
+                    numberElement.argument_ += defaults_[i * nargs_ + j];
+                    args_.newElement_(numberElement, defaults_[i * nargs_ + j].c_str());
                 }
-                default_ += defaults_[i];
-                push_back(ArgumentElement(defaults_[i].c_str(), defaults_[i].c_str()));
             }
-        }
-        if (type_ == Argument::INFINITE_POSITIONAL_ARGUMENT || type_ == Argument::MULTI_OPTION ||
-            type_ == Argument::INFINITE_OPTION || type_ == Argument::MULTI_INFINITE_OPTION) {
-            default_ = "";
+            break;
+        default:
+            break;
+    }
+}
+
+std::size_t Argument::memoryUsage_() const {
+    return ArgumentElement::memoryUsage_() + stringsMemory(nameOrFlags_) + stringsMemory(defaults_) +
+           stringMemory(default_) + stringMemory(help_) + stringMemory(metavar_) + stringMemory(group_) +
+           stringMemory(stringCache_);
+}
+
+void Argument::bindDest_(void* dest, void (*destCustom)(), void (*destFunction)(const Argument&),
+                         void (*streamFunction)(const Argument&, const char*)) {
+    dest_ = dest;
+    destCustom_ = destCustom;
+    destFunction_ = destFunction;
+    streamFunction_ = streamFunction;
+    isStream_ = (streamFunction != NULL);
+    Args::setBit_(args_.destBits_, index_, destFunction != NULL);
+}
+
+bool Argument::hasDefault_() const {
+    if (nargs_ == 0 || defaults_.empty()) {
+        return false;
+    }
+    // the default of groups is never empty: "(a, b)"
+    return defaults_.size() > 1 || !defaults_.front().empty();
+}
+
+void Argument::defaultTo_(std::string& str) const {
+    if (nargs_ == 0 || defaults_.empty()) {
+        return;
+    }
+    switch (type_) {
+        case POSITIONAL_ARGUMENT:
+        case SIMPLE_OPTION:
+            str += defaults_.front();
+            break;
+        case NUMBER_POSITIONAL_ARGUMENT:
+        case NUMBER_OPTION:
+        case INFINITE_POSITIONAL_ARGUMENT:
+        case MULTI_OPTION:
+        case INFINITE_OPTION:
+        case MULTI_INFINITE_OPTION:
             for (std::size_t i = 0; i < defaults_.size(); ++i) {
                 if (i > 0) {
-                    default_ += ", ";
+                    str += ", ";
                 }
-                default_ += defaults_[i];
-                push_back(ArgumentElement(defaults_[i].c_str(), defaults_[i].c_str()));
-            }
-        }
-        if (type_ == Argument::INFINITE_NUMBER_POSITIONAL_ARGUMENT || type_ == Argument::MULTI_NUMBER_OPTION ||
-            type_ == Argument::MULTI_NUMBER_INFINITE_OPTION) {
-            if (defaults_.size() % nargs_ != 0) {
-                throw ArgumentException(nameOrFlags_.front().c_str(),
-                                        "invalid number of argument with number of default argument");
+                str += defaults_[i];
             }
+            break;
+        case INFINITE_NUMBER_POSITIONAL_ARGUMENT:
+        case MULTI_NUMBER_OPTION:
+        case MULTI_NUMBER_INFINITE_OPTION:
             for (std::size_t i = 0; i < defaults_.size() / nargs_; ++i) {
                 if (i > 0) {
-                    default_ += ", ";
+                    str += ", ";
                 }
-                default_ += "(";
-                ArgumentElement newNumberArgument;
+                str += "(";
                 for (std::size_t j = 0; j < nargs_; ++j) {
                     if (j > 0) {
-                        default_ += ", ";
-                        newNumberArgument.default_ += ", ";
+                        str += ", ";
                     }
-                    default_ += defaults_[i * nargs_ + j];
-                    newNumberArgument.default_ += defaults_[i * nargs_ + j];
-                    newNumberArgument.push_back(
-                        ArgumentElement(defaults_[i * nargs_ + j].c_str(), defaults_[i * nargs_ + j].c_str()));
+                    str += defaults_[i * nargs_ + j];
                 }
-                default_ += ")";
-                push_back(newNumberArgument);
+                str += ")";
             }
-        }
-    }
-}
-
-void Argument::clear_() {
-    argument_ = default_;
-    isNumber_ = false;
-    number_ = 0.0;
-    count_ = 0;
-    isExist_ = false;
-    for (std::size_t i = 0; i < size(); ++i) {
-        at(i).argument_ = at(i).default_;
-        at(i).isNumber_ = false;
-        at(i).number_ = 0.0;
-        for (std::size_t j = 0; j < at(i).size(); ++j) {
-            at(i).at(j).argument_ = at(i).at(j).default_;
-            at(i).at(j).isNumber_ = false;
-            at(i).at(j).number_ = 0.0;
-        }
+            break;
+        default:
+            break;
     }
 }
 
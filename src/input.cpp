@@ -0,0 +1,115 @@
+/**
+ * args-input.cpp
+ *
+ * Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+ * Copyright (c) 2022-2023 BLET Mickael.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "blet/args/input.h"
+
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+
+#include "blet/args/exception.h"
+
+namespace blet {
+
+namespace args {
+
+InputReader::InputReader(int fd, char delimiter, std::size_t chunkSize) :
+    fd_(fd),
+    delimiter_(delimiter),
+    chunkSize_(chunkSize),
+    buffer_(new char[chunkSize + 1]),
+    capacity_(chunkSize + 1),
+    begin_(0),
+    end_(0),
+    isEnd_(false) {}
+
+InputReader::~InputReader() {
+    delete[] buffer_;
+}
+
+const char* InputReader::next() {
+    while (true) {
+        char* first = buffer_ + begin_;
+        char* last = static_cast<char*>(::memchr(first, delimiter_, end_ - begin_));
+        if (last != NULL) {
+            begin_ = last - buffer_ + 1;
+        }
+        else if (isEnd_) {
+            if (begin_ == end_) {
+                return NULL;
+            }
+            // last value without delimiter, a byte is always reserved after the end
+            last = buffer_ + end_;
+            begin_ = end_;
+        }
+        else {
+            fill_();
+            continue;
+        }
+        if (delimiter_ == '\n' && last != first && *(last - 1) == '\r') {
+            --last;
+        }
+        if (last != first) {
+            *last = '\0';
+            return first;
+        }
+    }
+}
+
+bool InputReader::fill_() {
+    // keep the incomplete value at the begin of buffer
+    std::size_t rest = end_ - begin_;
+    if (begin_ > 0) {
+        ::memmove(buffer_, buffer_ + begin_, rest);
+        begin_ = 0;
+        end_ = rest;
+    }
+    // grow only if a value is bigger than a chunk
+    if (capacity_ - end_ < chunkSize_ + 1) {
+        std::size_t capacity = capacity_ * 2;
+        char* buffer = new char[capacity];
+        ::memcpy(buffer, buffer_, end_);
+        delete[] buffer_;
+        buffer_ = buffer;
+        capacity_ = capacity;
+    }
+    ssize_t ret;
+    do {
+        ret = ::read(fd_, buffer_ + end_, chunkSize_);
+    } while (ret == -1 && errno == EINTR);
+    if (ret == -1) {
+        throw ParseArgumentException("cannot read input");
+    }
+    if (ret == 0) {
+        isEnd_ = true;
+    }
+    end_ += ret;
+    return !isEnd_;
+}
+
+} // namespace args
+
+} // namespace blet
@@ -0,0 +1,336 @@
+/**
+ * args-response.cpp
+ *
+ * Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+ * Copyright (c) 2022-2023 BLET Mickael.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "blet/args/response.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstring>
+
+#include "blet/args/exception.h"
+#include "blet/args/utils.h"
+
+namespace blet {
+
+namespace args {
+
+// number of last tokens kept valid
+static const std::size_t s_ringSize = 8;
+// the read pages of mapping are dropped by chunk of this size
+static const std::size_t s_releaseSize = 1 << 22;
+
+static inline bool s_isResponseFileArgument(const char* argument) {
+    return argument[0] == '@' && argument[1] != '\0';
+}
+
+static inline bool s_isShellSpace(char c) {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\v' || c == '\f';
+}
+
+/**
+ * @brief Drop the pages of mapping read before position, the page cache keeps them for a next read
+ *
+ * @param released [in,out] begin of pages not dropped
+ * @param position
+ */
+static inline void s_release(const char** released, const char* position) {
+    if (static_cast<std::size_t>(position - *released) >= s_releaseSize) {
+        std::size_t pageSize = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+        const char* last = position - reinterpret_cast<std::size_t>(position) % pageSize;
+        ::madvise(const_cast<char*>(*released), last - *released, MADV_DONTNEED);
+        *released = last;
+    }
+}
+
+ResponseFile::ResponseFile(enum eMode mode) :
+    mode_(mode),
+    argc_(0),
+    endOptionIndex_(0),
+    segments_(),
+    segment_(static_cast<std::size_t>(-1)),
+    position_(NULL),
+    released_(NULL),
+    next_(0),
+    tokens_(),
+    buffers_() {}
+
+ResponseFile::~ResponseFile() {
+    for (std::size_t i = 0; i < segments_.size(); ++i) {
+        if (segments_[i].argv == NULL) {
+            ::munmap(const_cast<char*>(segments_[i].begin), segments_[i].end - segments_[i].begin);
+        }
+    }
+}
+
+bool ResponseFile::expand(int argc, char* argv[]) {
+    if (mode_ == NONE) {
+        return false;
+    }
+    int endIndex = ::blet::args::endOptionIndex(argc, argv);
+    int index = 1;
+    while (index < endIndex && !s_isResponseFileArgument(argv[index])) {
+        ++index;
+    }
+    if (index >= endIndex) {
+        return false;
+    }
+    endOptionIndex_ = -1;
+    pushArguments_(argv, index);
+    while (index < endIndex) {
+        if (s_isResponseFileArgument(argv[index])) {
+            map_(argv[index]);
+            ++index;
+        }
+        else {
+            int first = index;
+            while (index < endIndex && !s_isResponseFileArgument(argv[index])) {
+                ++index;
+            }
+            pushArguments_(argv + first, index - first);
+        }
+    }
+    if (endOptionIndex_ == -1 && endIndex < argc) {
+        endOptionIndex_ = argc_;
+    }
+    pushArguments_(argv + endIndex, argc - endIndex);
+    if (endOptionIndex_ == -1) {
+        endOptionIndex_ = argc_;
+    }
+    tokens_.assign(s_ringSize, NULL);
+    buffers_.resize(s_ringSize);
+    return true;
+}
+
+const char* ResponseFile::token(int index) {
+    if (index < 0 || index >= argc_) {
+        return NULL;
+    }
+    std::size_t segment = std::upper_bound(segments_.begin(), segments_.end(), index, &ResponseFile::compareIndex_) -
+                          segments_.begin() - 1;
+    const Segment& current = segments_[segment];
+    if (current.argv != NULL) {
+        return current.argv[index - current.index];
+    }
+    // the tokens before the ring are read again from the begin of file
+    if (segment != segment_ || index + static_cast<int>(s_ringSize) < next_) {
+        segment_ = segment;
+        position_ = current.begin;
+        released_ = current.begin;
+        next_ = current.index;
+    }
+    while (next_ <= index) {
+        // the pages of next token are kept for the parser
+        s_release(&released_, position_);
+        std::size_t slot = static_cast<std::size_t>(next_) % s_ringSize;
+        tokens_[slot] = readToken_(current.argument, &position_, current.end, &buffers_[slot]);
+        ++next_;
+    }
+    return tokens_[static_cast<std::size_t>(index) % s_ringSize];
+}
+
+int ResponseFile::endOptionIndex(int index) {
+    if (index <= endOptionIndex_) {
+        return endOptionIndex_;
+    }
+    while (index < argc_ && !isEndOption(token(index))) {
+        ++index;
+    }
+    return index;
+}
+
+std::size_t ResponseFile::memoryUsage() const {
+    std::size_t ret = sizeof(ResponseFile) + segments_.capacity() * sizeof(Segment) +
+                      tokens_.capacity() * sizeof(const char*) + stringsMemory(buffers_);
+    return ret;
+}
+
+void ResponseFile::map_(const char* argument) {
+    int fd = ::open(argument + 1, O_RDONLY);
+    if (fd == -1) {
+        throw ParseArgumentException(argument, "cannot open response file");
+    }
+    struct stat statBuff;
+    if (::fstat(fd, &statBuff) == -1 || !S_ISREG(statBuff.st_mode)) {
+        ::close(fd);
+        throw ParseArgumentException(argument, "response file is not a regular file");
+    }
+    std::size_t size = static_cast<std::size_t>(statBuff.st_size);
+    if (size == 0) {
+        ::close(fd);
+        return;
+    }
+    // the file is only read, its pages stay shared with the page cache
+    void* addr = ::mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (addr == MAP_FAILED) {
+        throw ParseArgumentException(argument, "cannot map response file");
+    }
+    Segment segment;
+    segment.argv = NULL;
+    segment.argument = argument;
+    segment.begin = static_cast<const char*>(addr);
+    segment.end = segment.begin + size;
+    segment.index = argc_;
+    segments_.push_back(segment);
+    ::madvise(addr, size, MADV_SEQUENTIAL);
+    // count the tokens, the mapping is read again by the parser
+    std::string buffer;
+    const char* position = segment.begin;
+    const char* released = segment.begin;
+    const char* token;
+    while ((token = readToken_(argument, &position, segment.end, &buffer)) != NULL) {
+        if (endOptionIndex_ == -1 && isEndOption(token)) {
+            endOptionIndex_ = argc_;
+        }
+        ++argc_;
+        s_release(&released, position);
+    }
+}
+
+void ResponseFile::pushArguments_(char** argv, int count) {
+    if (count == 0) {
+        return;
+    }
+    Segment segment;
+    segment.argv = argv;
+    segment.argument = NULL;
+    segment.begin = NULL;
+    segment.end = NULL;
+    segment.index = argc_;
+    segments_.push_back(segment);
+    argc_ += count;
+}
+
+const char* ResponseFile::readToken_(const char* argument, const char** position, const char* end,
+                                     std::string* buffer) const {
+    const char* it = *position;
+    const char* token = NULL;
+    switch (mode_) {
+        case NUL:
+            // already terminated, the token is used in place
+            while (token == NULL && it < end) {
+                const char* nul = static_cast<const char*>(::memchr(it, '\0', end - it));
+                if (nul == NULL) {
+                    // the end of mapping can't be terminated in place
+                    buffer->assign(it, end);
+                    token = buffer->c_str();
+                    it = end;
+                }
+                else {
+                    if (nul != it) {
+                        token = it;
+                    }
+                    it = nul + 1;
+                }
+            }
+            break;
+        case NEWLINE:
+            while (token == NULL && it < end) {
+                const char* newline = static_cast<const char*>(::memchr(it, '\n', end - it));
+                const char* last = (newline == NULL) ? end : newline;
+                if (last != it && *(last - 1) == '\r') {
+                    --last;
+                }
+                if (last != it) {
+                    buffer->assign(it, last);
+                    token = buffer->c_str();
+                }
+                it = (newline == NULL) ? end : newline + 1;
+            }
+            break;
+        case SHELL:
+            while (token == NULL && it < end) {
+                while (it < end && s_isShellSpace(*it)) {
+                    ++it;
+                }
+                if (it == end) {
+                    break;
+                }
+                // comment
+                if (*it == '#') {
+                    while (it < end && *it != '\n') {
+                        ++it;
+                    }
+                    continue;
+                }
+                // unquote in buffer
+                buffer->clear();
+                while (it < end && !s_isShellSpace(*it)) {
+                    if (*it == '\'' || *it == '\"') {
+                        char quote = *it;
+                        ++it;
+                        while (it < end && *it != quote) {
+                            if (quote == '\"' && *it == '\\' && it + 1 < end &&
+                                (it[1] == '\"' || it[1] == '\\')) {
+                                ++it;
+                            }
+                            buffer->push_back(*it++);
+                        }
+                        if (it == end) {
+                            throw ParseArgumentException(argument, "unterminated quote in response file");
+                        }
+                        ++it;
+                    }
+                    else if (*it == '\\' && it + 1 < end) {
+                        ++it;
+                        buffer->push_back(*it++);
+                    }
+                    else {
+                        // append the run of plain characters
+                        const char* first = it;
+                        while (it < end && !s_isShellSpace(*it) && *it != '\'' && *it != '\"' && *it != '\\') {
+                            ++it;
+                        }
+                        if (it == first) {
+                            ++it;
+                        }
+                        buffer->append(first, it);
+                    }
+                }
+                token = buffer->c_str();
+            }
+            break;
+        default:
+            break;
+    }
+    *position = it;
+    return token;
+}
+
+int Tokens::endOptionIndex(int argc) const {
+    if (responseFile_ == NULL) {
+        return ::blet::args::endOptionIndex(argc, argv_ + offset_);
+    }
+    int index = responseFile_->endOptionIndex(offset_);
+    return (index - offset_ < argc) ? index - offset_ : argc;
+}
+
+} // namespace args
+
+} // namespace blet
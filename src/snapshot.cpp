@@ -0,0 +1,391 @@
+/**
+ * args-snapshot.cpp
+ *
+ * Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+ * Copyright (c) 2022-2023 BLET Mickael.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "blet/args/snapshot.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+
+#include "blet/args/args.h"
+#include "blet/args/argument.h"
+#include "blet/args/exception.h"
+#include "blet/args/table.h"
+#include "blet/args/utils.h"
+
+namespace blet {
+
+namespace args {
+
+static const char s_snapshotMagic[8] = {'B', 'L', 'E', 'T', 'A', 'R', 'G', 'S'};
+
+/**
+ * @brief Append the parts of snapshot aligned on Offset
+ */
+class SnapshotWriter {
+  public:
+    SnapshotWriter() :
+        buffer_(sizeof(Snapshot::Header), '\0') {}
+
+    Snapshot::Offset push(const void* data, std::size_t size) {
+        buffer_.resize((buffer_.size() + sizeof(Snapshot::Offset) - 1) & ~(sizeof(Snapshot::Offset) - 1), '\0');
+        Snapshot::Offset offset = static_cast<Snapshot::Offset>(buffer_.size());
+        buffer_.append(static_cast<const char*>(data), size);
+        return offset;
+    }
+
+    Snapshot::Offset push(const std::string& str) {
+        return push(str.c_str(), str.size() + 1);
+    }
+
+    Snapshot::Offset push(const std::vector<Snapshot::Offset>& offsets) {
+        if (offsets.empty()) {
+            return 0;
+        }
+        return push(&offsets[0], offsets.size() * sizeof(Snapshot::Offset));
+    }
+
+    Snapshot::Header& header() {
+        return *reinterpret_cast<Snapshot::Header*>(&buffer_[0]);
+    }
+
+    const std::string& buffer() const {
+        return buffer_;
+    }
+
+  private:
+    std::string buffer_;
+};
+
+/*
+################################################################################
+ Snapshot
+################################################################################
+*/
+
+Snapshot::Snapshot() :
+    data_(NULL),
+    size_(0) {}
+
+Snapshot::~Snapshot() {
+    if (data_ != NULL) {
+        ::munmap(const_cast<char*>(data_), size_);
+    }
+}
+
+void Snapshot::map(const char* filename) {
+    int fd = ::open(filename, O_RDONLY);
+    if (fd == -1) {
+        throw Exception("cannot open snapshot");
+    }
+    struct stat st;
+    if (::fstat(fd, &st) == -1 || !S_ISREG(st.st_mode) || static_cast<std::size_t>(st.st_size) < sizeof(Header)) {
+        ::close(fd);
+        throw Exception("invalid snapshot");
+    }
+    size_ = static_cast<std::size_t>(st.st_size);
+    void* addr = ::mmap(NULL, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (addr == MAP_FAILED) {
+        size_ = 0;
+        throw Exception("cannot map snapshot");
+    }
+    data_ = static_cast<const char*>(addr);
+    const Header& h = header();
+    if (::memcmp(h.magic, s_snapshotMagic, sizeof(s_snapshotMagic)) != 0 || h.endian != ENDIAN) {
+        throw Exception("invalid snapshot");
+    }
+    if (h.version != VERSION) {
+        throw Exception("invalid snapshot version");
+    }
+    // the last '\0' bounds all the strings
+    if (h.size != size_ || data_[size_ - 1] != '\0' || !isArray_(h.arguments, h.argumentCount, sizeof(Argument)) ||
+        !isArray_(h.slots, h.slotCount, sizeof(Slot)) ||
+        !isArray_(h.displacements, h.displacementCount, sizeof(Offset)) ||
+        !isArray_(h.shortOptions, 128, sizeof(Offset)) || (h.slotCount > 0 && h.displacementCount == 0) ||
+        !isString_(h.description) || !isString_(h.epilog) || !isString_(h.usage) || !isString_(h.versionMessage)) {
+        throw Exception("invalid snapshot size");
+    }
+    // each offset and index is checked, a corrupted file never reads out of the mapping
+    for (std::size_t i = 0; i < h.argumentCount; ++i) {
+        const Argument& a = argument(i);
+        if (a.flagCount == 0 || !isArray_(a.nameOrFlags, a.flagCount, sizeof(Offset)) ||
+            !isArray_(a.defaults, a.defaultCount, sizeof(Offset)) || a.action > Action::INFINITE ||
+            a.nargs > MAX_NARGS ||
+            !isString_(a.help) || !isString_(a.metavar)) {
+            throw Exception("invalid snapshot argument");
+        }
+        const Offset* nameOrFlags = offsets(a.nameOrFlags);
+        for (std::size_t j = 0; j < a.flagCount; ++j) {
+            if (nameOrFlags[j] == 0 || !isString_(nameOrFlags[j]) || data_[nameOrFlags[j]] == '\0') {
+                throw Exception("invalid snapshot argument");
+            }
+        }
+        const Offset* defaults = offsets(a.defaults);
+        for (std::size_t j = 0; j < a.defaultCount; ++j) {
+            if (defaults[j] == 0 || !isString_(defaults[j])) {
+                throw Exception("invalid snapshot argument");
+            }
+        }
+    }
+    const Slot* slots = reinterpret_cast<const Slot*>(data_ + h.slots);
+    for (std::size_t i = 0; i < h.slotCount; ++i) {
+        if (slots[i].nameOrFlag != 0 && (!isString_(slots[i].nameOrFlag) || slots[i].argument >= h.argumentCount)) {
+            throw Exception("invalid snapshot index");
+        }
+    }
+    const Offset* shortOptions = offsets(h.shortOptions);
+    for (std::size_t i = 0; i < 128; ++i) {
+        if (shortOptions[i] > h.argumentCount) {
+            throw Exception("invalid snapshot index");
+        }
+    }
+}
+
+bool Snapshot::isArray_(Offset offset, std::size_t count, std::size_t elementSize) const {
+    // aligned and in the mapping without overflow
+    return offset % sizeof(Offset) == 0 && offset <= size_ && count <= (size_ - offset) / elementSize;
+}
+
+bool Snapshot::isString_(Offset offset) const {
+    return offset < size_;
+}
+
+std::size_t Snapshot::find(const char* str, std::size_t size) const {
+    const Header& h = header();
+    if (h.slotCount == 0) {
+        return static_cast<std::size_t>(-1);
+    }
+    Offset displacement = offsets(h.displacements)[tableHash(str, size, 0) % h.displacementCount];
+    const Slot& slot =
+        reinterpret_cast<const Slot*>(data_ + h.slots)[tableHash(str, size, displacement) % h.slotCount];
+    if (slot.nameOrFlag == 0 || ::strncmp(data_ + slot.nameOrFlag, str, size) != 0 ||
+        data_[slot.nameOrFlag + size] != '\0') {
+        return static_cast<std::size_t>(-1);
+    }
+    return slot.argument;
+}
+
+/*
+################################################################################
+ Args
+################################################################################
+*/
+
+void Args::saveSnapshot(const char* filename) const {
+    SnapshotWriter writer;
+    std::vector<Snapshot::Argument> snapshotArguments;
+    std::vector<std::string> keys;
+    std::vector<Snapshot::Offset> keyOffsets;
+    std::vector<Snapshot::Offset> keyArguments;
+    std::vector<Snapshot::Offset> shortOptions(128, 0);
+    snapshotArguments.reserve(arguments_.size());
+    // arguments in the order of usage
+    for (std::vector<Argument*>::const_iterator it = arguments_.begin(); it != arguments_.end(); ++it) {
+        const Argument& argument = **it;
+        if (argument.nargs_ > Snapshot::MAX_NARGS) {
+            throw ArgumentException(argument.nameOrFlags_.front().c_str(), "too many arguments for snapshot");
+        }
+        Snapshot::Argument snapshotArgument;
+        std::vector<Snapshot::Offset> offsets;
+        for (std::size_t i = 0; i < argument.nameOrFlags_.size(); ++i) {
+            offsets.push_back(writer.push(argument.nameOrFlags_[i]));
+            keys.push_back(argument.nameOrFlags_[i]);
+            keyOffsets.push_back(offsets.back());
+            keyArguments.push_back(static_cast<Snapshot::Offset>(snapshotArguments.size()));
+            if (isShortOption(argument.nameOrFlags_[i].c_str()) &&
+                static_cast<unsigned char>(argument.nameOrFlags_[i][1]) < 128) {
+                shortOptions[static_cast<unsigned char>(argument.nameOrFlags_[i][1])] =
+                    static_cast<Snapshot::Offset>(snapshotArguments.size() + 1);
+            }
+        }
+        snapshotArgument.nameOrFlags = writer.push(offsets);
+        snapshotArgument.flagCount = static_cast<Snapshot::Offset>(offsets.size());
+        offsets.clear();
+        for (std::size_t i = 0; i < argument.defaults_.size(); ++i) {
+            offsets.push_back(writer.push(argument.defaults_[i]));
+        }
+        snapshotArgument.defaults = writer.push(offsets);
+        snapshotArgument.defaultCount = static_cast<Snapshot::Offset>(offsets.size());
+        snapshotArgument.action = static_cast<Snapshot::Offset>(argument.action_);
+        snapshotArgument.nargs = static_cast<Snapshot::Offset>(argument.nargs_);
+        snapshotArgument.help = argument.getHelp().empty() ? 0 : writer.push(argument.getHelp());
+        snapshotArgument.metavar = argument.getMetavar().empty() ? 0 : writer.push(argument.getMetavar());
+        snapshotArgument.isRequired = argument.isRequired_ ? 1 : 0;
+        snapshotArguments.push_back(snapshotArgument);
+    }
+    // perfect hash of names and flags
+    std::vector<std::size_t> slotKeys;
+    std::vector<unsigned int> displacements;
+    tableBuildPerfectHash(keys, &slotKeys, &displacements);
+    std::vector<Snapshot::Slot> slots(slotKeys.size());
+    for (std::size_t i = 0; i < slotKeys.size(); ++i) {
+        slots[i].nameOrFlag = slotKeys[i] == 0 ? 0 : keyOffsets[slotKeys[i] - 1];
+        slots[i].argument = slotKeys[i] == 0 ? 0 : keyArguments[slotKeys[i] - 1];
+    }
+
+    Snapshot::Header header;
+    ::memcpy(header.magic, s_snapshotMagic, sizeof(s_snapshotMagic));
+    header.version = Snapshot::VERSION;
+    header.endian = Snapshot::ENDIAN;
+    header.description = description_.empty() ? 0 : writer.push(description_);
+    header.epilog = epilog_.empty() ? 0 : writer.push(epilog_);
+    header.usage = usage_.empty() ? 0 : writer.push(usage_);
+    header.versionMessage = version_.empty() ? 0 : writer.push(version_);
+    header.argumentCount = static_cast<Snapshot::Offset>(snapshotArguments.size());
+    header.arguments = snapshotArguments.empty()
+                           ? 0
+                           : writer.push(&snapshotArguments[0], snapshotArguments.size() * sizeof(Snapshot::Argument));
+    header.slotCount = static_cast<Snapshot::Offset>(slots.size());
+    header.slots = writer.push(&slots[0], slots.size() * sizeof(Snapshot::Slot));
+    header.displacementCount = static_cast<Snapshot::Offset>(displacements.size());
+    header.displacements = writer.push(&displacements[0], displacements.size() * sizeof(Snapshot::Offset));
+    header.shortOptions = writer.push(shortOptions);
+    // end of strings
+    writer.push("", 1);
+    header.size = static_cast<Snapshot::Offset>(writer.buffer().size());
+    writer.header() = header;
+
+    int fd = ::open(filename, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd == -1) {
+        throw Exception("cannot open snapshot");
+    }
+    const char* data = writer.buffer().c_str();
+    std::size_t size = writer.buffer().size();
+    while (size > 0) {
+        ssize_t ret = ::write(fd, data, size);
+        if (ret == -1 && errno == EINTR) {
+            continue;
+        }
+        if (ret <= 0) {
+            ::close(fd);
+            throw Exception("cannot write snapshot");
+        }
+        data += ret;
+        size -= static_cast<std::size_t>(ret);
+    }
+    ::close(fd);
+}
+
+void Args::loadSnapshot(const char* filename) {
+    Snapshot* snapshot = new Snapshot();
+    try {
+        snapshot->map(filename);
+        const Snapshot::Header& header = snapshot->header();
+        // check if all names or flags not exists
+        for (std::size_t i = 0; i < header.argumentCount; ++i) {
+            const Snapshot::Argument& snapshotArgument = snapshot->argument(i);
+            const Snapshot::Offset* nameOrFlags = snapshot->offsets(snapshotArgument.nameOrFlags);
+            for (std::size_t j = 0; j < snapshotArgument.flagCount; ++j) {
+                if (findArgument_(snapshot->string(nameOrFlags[j])) != NULL) {
+                    throw ArgumentException(snapshot->string(nameOrFlags[j]), "invalid flag already exist");
+                }
+            }
+        }
+    }
+    catch (...) {
+        delete snapshot;
+        throw;
+    }
+    snapshots_.push_back(snapshot);
+    const Snapshot::Header& header = snapshot->header();
+    // arguments are saved in the order of usage
+    bool isSorted = arguments_.empty();
+    dropIndex_();
+    hasSortedFlags_ = false;
+    std::size_t size = arguments_.size();
+    tableArguments_.reserve(header.argumentCount);
+    arguments_.reserve(size + header.argumentCount);
+    try {
+        loadSnapshotArguments_(*snapshot);
+    }
+    catch (...) {
+        // remove the arguments of snapshot (e.g. help action already defined)
+        tableArguments_.clear();
+        deleteLastArguments_(size);
+        snapshots_.pop_back();
+        delete snapshot;
+        throw;
+    }
+    if (header.description != 0) {
+        description_ = snapshot->string(header.description);
+    }
+    if (header.epilog != 0) {
+        epilog_ = snapshot->string(header.epilog);
+    }
+    if (header.usage != 0) {
+        usage_ = snapshot->string(header.usage);
+    }
+    if (header.versionMessage != 0) {
+        version_ = snapshot->string(header.versionMessage);
+    }
+    snapshot_ = snapshot;
+    if (!isSorted) {
+        sortArguments_();
+    }
+    clearUsageCache_();
+}
+
+void Args::loadSnapshotArguments_(const Snapshot& snapshot) {
+    const Snapshot::Header& header = snapshot.header();
+    for (std::size_t i = 0; i < header.argumentCount; ++i) {
+        const Snapshot::Argument& snapshotArgument = snapshot.argument(i);
+        const Snapshot::Offset* nameOrFlags = snapshot.offsets(snapshotArgument.nameOrFlags);
+        const Snapshot::Offset* defaults = snapshot.offsets(snapshotArgument.defaults);
+        Argument* argument = newArgument_();
+        arguments_.push_back(argument);
+        tableArguments_.push_back(argument);
+        argument->nameOrFlags_.reserve(snapshotArgument.flagCount);
+        // the names and flags are only in the index of snapshot until dropIndex_
+        for (std::size_t j = 0; j < snapshotArgument.flagCount; ++j) {
+            argument->nameOrFlags_.push_back(snapshot.string(nameOrFlags[j]));
+        }
+        if (argument->nameOrFlags_.front()[0] != '-') {
+            argument->type_ = Argument::POSITIONAL_ARGUMENT;
+        }
+        argument->nargs_ = snapshotArgument.nargs;
+        argument->action_ = static_cast<enum Action::eAction>(snapshotArgument.action);
+        argument->typeConstructor_();
+        if (snapshotArgument.defaultCount > 0) {
+            argument->defaults_.reserve(snapshotArgument.defaultCount);
+            for (std::size_t j = 0; j < snapshotArgument.defaultCount; ++j) {
+                argument->defaults_.push_back(snapshot.string(defaults[j]));
+            }
+            argument->defaultsConstructor_();
+        }
+        argument->isRequired_ = snapshotArgument.isRequired != 0;
+        setBit_(requiredBits_, argument->index_, argument->isRequired_);
+        argument->helpLiteral_ = snapshot.string(snapshotArgument.help);
+        argument->metavarLiteral_ = snapshot.string(snapshotArgument.metavar);
+    }
+}
+
+} // namespace args
+
+} // namespace blet
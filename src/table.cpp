@@ -0,0 +1,87 @@
+/**
+ * args-table.cpp
+ *
+ * Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+ * Copyright (c) 2022-2023 BLET Mickael.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "blet/args/table.h"
+
+#include <algorithm>
+
+namespace blet {
+
+namespace args {
+
+void tableBuildPerfectHash(const std::vector<std::string>& keys, std::vector<std::size_t>* slots,
+                           std::vector<unsigned int>* displacements) {
+    std::size_t slotCount = keys.size() + keys.size() / 4 + 1;
+    std::size_t bucketCount = keys.size() / 2 + 1;
+    std::vector<std::vector<std::size_t> > buckets(bucketCount);
+    for (std::size_t i = 0; i < keys.size(); ++i) {
+        buckets[tableHash(keys[i].c_str(), keys[i].size(), 0) % bucketCount].push_back(i);
+    }
+    // place the biggest buckets first
+    std::vector<std::pair<std::size_t, std::size_t> > order;
+    order.reserve(bucketCount);
+    for (std::size_t i = 0; i < bucketCount; ++i) {
+        order.push_back(std::pair<std::size_t, std::size_t>(buckets[i].size(), i));
+    }
+    std::sort(order.rbegin(), order.rend());
+    std::vector<std::size_t> positions;
+    for (;;) {
+        slots->assign(slotCount, 0);
+        displacements->assign(bucketCount, 0);
+        bool isPerfect = true;
+        for (std::size_t i = 0; i < order.size() && order[i].first > 0 && isPerfect; ++i) {
+            const std::vector<std::size_t>& bucket = buckets[order[i].second];
+            isPerfect = false;
+            for (unsigned int seed = 1; seed < 1000000 && !isPerfect; ++seed) {
+                positions.clear();
+                for (std::size_t j = 0; j < bucket.size(); ++j) {
+                    const std::string& key = keys[bucket[j]];
+                    std::size_t position = tableHash(key.c_str(), key.size(), seed) % slotCount;
+                    if ((*slots)[position] != 0 ||
+                        std::find(positions.begin(), positions.end(), position) != positions.end()) {
+                        break;
+                    }
+                    positions.push_back(position);
+                }
+                if (positions.size() == bucket.size()) {
+                    for (std::size_t j = 0; j < bucket.size(); ++j) {
+                        (*slots)[positions[j]] = bucket[j] + 1;
+                    }
+                    (*displacements)[order[i].second] = seed;
+                    isPerfect = true;
+                }
+            }
+        }
+        if (isPerfect) {
+            return;
+        }
+        // too full, retry with more slots
+        slotCount += slotCount / 2;
+    }
+}
+
+} // namespace args
+
+} // namespace blet
@@ -1,9 +1,15 @@
 #include "blet/args/usage.h"
 
-#include <sstream>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <cstring>
 
 #include "blet/args/args.h"
 #include "blet/args/argument.h"
+#include "blet/args/utils.h"
 
 #if defined _WIN32 || defined _WIN64 || defined __CYGWIN__
 #define ARGS_SEPARATOR_PATH_ '\\'
@@ -23,38 +29,386 @@ Usage::Usage(Args& args) :
     usagePadWidth_(2),
     usageArgsWidth_(20),
     usageSepWidth_(2),
-    usageHelpWidth_(56) {}
+    usageHelpWidth_(56),
+    usageCache_(),
+    hasUsageCache_(false),
+    indexArguments_(),
+    indexFlags_(),
+    indexGroups_(),
+    indexHelp_(),
+    indexHelpOffsets_(),
+    hasUsageIndex_(false) {}
 
 Usage::~Usage() {}
 
-static inline std::vector<std::string> s_multilineWrap(const std::string& str, std::size_t widthMax) {
-    std::vector<std::string> lines;
-    std::string line;
-    std::istringstream iss(str);
-    while (std::getline(iss, line)) {
-        while (line.size() >= widthMax) {
-            std::size_t spacePos = line.rfind(' ', widthMax);
-            if (spacePos != std::string::npos) {
-                lines.push_back(line.substr(0, spacePos));
-                while (spacePos < line.size() && line.at(spacePos) == ' ') {
-                    ++spacePos;
-                }
-                line = line.substr(spacePos);
+static inline bool s_isZeroWidth(unsigned long codePoint) {
+    return (codePoint >= 0x0300 && codePoint <= 0x036F) || (codePoint >= 0x200B && codePoint <= 0x200F) ||
+           (codePoint >= 0x20D0 && codePoint <= 0x20FF) || (codePoint >= 0xFE00 && codePoint <= 0xFE0F);
+}
+
+static inline bool s_isWide(unsigned long codePoint) {
+    return (codePoint >= 0x1100 && codePoint <= 0x115F) || (codePoint >= 0x2E80 && codePoint <= 0xA4CF) ||
+           (codePoint >= 0xAC00 && codePoint <= 0xD7A3) || (codePoint >= 0xF900 && codePoint <= 0xFAFF) ||
+           (codePoint >= 0xFE30 && codePoint <= 0xFE4F) || (codePoint >= 0xFF00 && codePoint <= 0xFF60) ||
+           (codePoint >= 0xFFE0 && codePoint <= 0xFFE6) || (codePoint >= 0x1F300 && codePoint <= 0x1F64F) ||
+           (codePoint >= 0x1F900 && codePoint <= 0x1F9FF) || (codePoint >= 0x20000 && codePoint <= 0x3FFFD);
+}
+
+/**
+ * @brief Get the display width of the UTF-8 character at str, an invalid sequence is one byte of width 1
+ */
+static inline std::size_t s_utf8Width(const char* str, std::size_t size, std::size_t* charSize) {
+    unsigned char c = static_cast<unsigned char>(str[0]);
+    std::size_t length = 1;
+    unsigned long codePoint = c;
+    if ((c & 0xE0) == 0xC0) {
+        length = 2;
+        codePoint = c & 0x1F;
+    }
+    else if ((c & 0xF0) == 0xE0) {
+        length = 3;
+        codePoint = c & 0x0F;
+    }
+    else if ((c & 0xF8) == 0xF0) {
+        length = 4;
+        codePoint = c & 0x07;
+    }
+    *charSize = 1;
+    if (length == 1 || length > size) {
+        return 1;
+    }
+    for (std::size_t i = 1; i < length; ++i) {
+        unsigned char next = static_cast<unsigned char>(str[i]);
+        if ((next & 0xC0) != 0x80) {
+            return 1;
+        }
+        codePoint = (codePoint << 6) | (next & 0x3F);
+    }
+    *charSize = length;
+    if (s_isZeroWidth(codePoint)) {
+        return 0;
+    }
+    if (s_isWide(codePoint)) {
+        return 2;
+    }
+    return 1;
+}
+
+/**
+ * @brief Split a text in lines of a maximum display width, lines are spans of the original text.
+ *        A line is cut at the last space before the width, a word longer than the width is not cut.
+ */
+class MultilineWrap {
+  public:
+    MultilineWrap(const std::string& str, std::size_t widthMax) :
+        str_(str.c_str()),
+        size_(str.size()),
+        widthMax_(widthMax),
+        pos_(0),
+        lineEnd_(0),
+        isInLine_(false) {}
+
+    /**
+     * @brief Get the next line
+     *
+     * @param offset offset of line in text
+     * @param length length of line
+     * @return [false] at end of text
+     */
+    bool next(std::size_t* offset, std::size_t* length) {
+        if (!isInLine_ && pos_ >= size_) {
+            return false;
+        }
+        // the end of line is searched once by line of text, not by wrapped line
+        if (!isInLine_) {
+            const char* newline = static_cast<const char*>(::memchr(str_ + pos_, '\n', size_ - pos_));
+            lineEnd_ = (newline == NULL) ? size_ : newline - str_;
+        }
+        std::size_t end = lineEnd_;
+        std::size_t begin = pos_;
+        std::size_t width = 0;
+        std::size_t breakPos = std::string::npos;
+        std::size_t it = begin;
+        // each character is read at most twice: the part after the break is read again by the next line
+        while (it < end && width <= widthMax_) {
+            if (str_[it] == ' ') {
+                breakPos = it;
             }
-            else {
-                break;
+            std::size_t charSize;
+            width += s_utf8Width(str_ + it, end - it, &charSize);
+            it += charSize;
+        }
+        if (width >= widthMax_ && breakPos != std::string::npos) {
+            *offset = begin;
+            *length = breakPos - begin;
+            // skip the spaces
+            while (breakPos < end && str_[breakPos] == ' ') {
+                ++breakPos;
+            }
+            pos_ = breakPos;
+            isInLine_ = true;
+        }
+        else {
+            *offset = begin;
+            *length = end - begin;
+            pos_ = end + 1;
+            isInLine_ = false;
+        }
+        return true;
+    }
+
+  private:
+    const char* str_;
+    std::size_t size_;
+    std::size_t widthMax_;
+    std::size_t pos_;
+    std::size_t lineEnd_;
+    bool isInLine_;
+};
+
+static void s_sinkToFd(void* fd, const char* str, std::size_t size) {
+    int* pFd = static_cast<int*>(fd);
+    while (size > 0 && *pFd != -1) {
+        ssize_t ret = ::write(*pFd, str, size);
+        if (ret == -1) {
+            if (errno == EINTR) {
+                continue;
             }
+            // stop to write (e.g. pager closed)
+            *pFd = -1;
+            break;
         }
-        lines.push_back(line);
+        str += ret;
+        size -= ret;
     }
-    return lines;
 }
 
-std::string Usage::getUsage() const {
+static void s_sinkToString(void* str, const char* data, std::size_t size) {
+    static_cast<std::string*>(str)->append(data, size);
+}
+
+/**
+ * @brief Fixed size buffer flushed in a sink, the last flush is called by the owner and not by the destructor
+ * (a sink can throw)
+ */
+class UsageWriter {
+  public:
+    UsageWriter(Usage::Sink sink, void* user) :
+        sink_(sink),
+        user_(user),
+        size_(0) {}
+
+    ~UsageWriter() {}
+
+    void write(const char* str, std::size_t size) {
+        if (size_ + size > sizeof(buffer_)) {
+            flush();
+            // too big for buffer: no copy
+            if (size > sizeof(buffer_)) {
+                sink_(user_, str, size);
+                return;
+            }
+        }
+        ::memcpy(buffer_ + size_, str, size);
+        size_ += size;
+    }
+
+    void write(const std::string& str) {
+        write(str.c_str(), str.size());
+    }
+
+    void write(char c) {
+        if (size_ == sizeof(buffer_)) {
+            flush();
+        }
+        buffer_[size_++] = c;
+    }
+
+    void fill(char c, std::size_t count) {
+        while (count > 0) {
+            if (size_ == sizeof(buffer_)) {
+                flush();
+            }
+            std::size_t n = sizeof(buffer_) - size_;
+            if (n > count) {
+                n = count;
+            }
+            ::memset(buffer_ + size_, c, n);
+            size_ += n;
+            count -= n;
+        }
+    }
+
+    void flush() {
+        if (size_ > 0) {
+            sink_(user_, buffer_, size_);
+            size_ = 0;
+        }
+    }
+
+  private:
+    UsageWriter(const UsageWriter&);            // disable copy constructor
+    UsageWriter& operator=(const UsageWriter&); // disable copy operator
+
+    Usage::Sink sink_;
+    void* user_;
+    std::size_t size_;
+    char buffer_[4096];
+};
+
+const std::string& Usage::getUsage() const {
     if (!usage_.empty()) {
         return usage_;
     }
-    std::ostringstream oss("");
+    if (!hasUsageCache_) {
+        std::string usage;
+        UsageWriter writer(&s_sinkToString, &usage);
+        writeUsage_(writer);
+        writer.flush();
+        usageCache_.swap(usage);
+        hasUsageCache_ = true;
+    }
+    return usageCache_;
+}
+
+void Usage::writeUsage(int fd) const {
+    writeUsage(&s_sinkToFd, &fd);
+}
+
+void Usage::writeUsage(Sink sink, void* user) const {
+    UsageWriter writer(sink, user);
+    if (!usage_.empty()) {
+        writer.write(usage_);
+    }
+    else if (hasUsageCache_) {
+        writer.write(usageCache_);
+    }
+    else {
+        writeUsage_(writer);
+    }
+    writer.flush();
+}
+
+static inline bool s_compareIndexFlag(const std::pair<std::string, std::size_t>& first,
+                                      const std::pair<std::string, std::size_t>& second) {
+    return first.first < second.first;
+}
+
+static inline std::string s_toLower(const std::string& str) {
+    std::string ret(str);
+    for (std::size_t i = 0; i < ret.size(); ++i) {
+        ret[i] = static_cast<char>(::tolower(static_cast<unsigned char>(ret[i])));
+    }
+    return ret;
+}
+
+std::string Usage::getUsage(const std::string& pattern, enum eFilter filter, std::size_t first,
+                            std::size_t count) const {
+    std::string usage;
+    UsageWriter writer(&s_sinkToString, &usage);
+    writeFilteredUsage_(writer, pattern, filter, first, count);
+    writer.flush();
+    return usage;
+}
+
+void Usage::writeUsage(int fd, const std::string& pattern, enum eFilter filter, std::size_t first,
+                       std::size_t count) const {
+    UsageWriter writer(&s_sinkToFd, &fd);
+    writeFilteredUsage_(writer, pattern, filter, first, count);
+    writer.flush();
+}
+
+std::size_t Usage::usageMemory_() const {
+    std::size_t ret = stringMemory(description_) + stringMemory(epilog_) + stringMemory(usage_) +
+                      stringMemory(usageCache_) + stringMemory(indexHelp_);
+    ret += indexArguments_.capacity() * sizeof(Argument*);
+    ret += indexFlags_.capacity() * sizeof(std::pair<std::string, std::size_t>);
+    for (std::size_t i = 0; i < indexFlags_.size(); ++i) {
+        ret += stringMemory(indexFlags_[i].first);
+    }
+    ret += indexGroups_.capacity() * sizeof(std::pair<std::string, std::size_t>);
+    for (std::size_t i = 0; i < indexGroups_.size(); ++i) {
+        ret += stringMemory(indexGroups_[i].first);
+    }
+    ret += indexHelpOffsets_.capacity() * sizeof(std::pair<std::size_t, std::size_t>);
+    return ret;
+}
+
+void Usage::buildUsageIndex_() const {
+    indexArguments_.clear();
+    indexFlags_.clear();
+    indexGroups_.clear();
+    indexHelp_.clear();
+    indexHelpOffsets_.clear();
+    std::vector<Argument*>::const_iterator it;
+    for (it = args_.arguments_.begin(); it != args_.arguments_.end(); ++it) {
+        std::size_t ordinal = indexArguments_.size();
+        indexArguments_.push_back(*it);
+        for (std::size_t i = 0; i < (*it)->nameOrFlags_.size(); ++i) {
+            indexFlags_.push_back(std::pair<std::string, std::size_t>((*it)->nameOrFlags_[i], ordinal));
+        }
+        if (!(*it)->group_.empty()) {
+            indexGroups_.push_back(std::pair<std::string, std::size_t>((*it)->group_, ordinal));
+        }
+        indexHelpOffsets_.push_back(std::pair<std::size_t, std::size_t>(indexHelp_.size(), ordinal));
+        indexHelp_ += s_toLower((*it)->getHelp());
+        indexHelp_ += '\0';
+    }
+    std::sort(indexFlags_.begin(), indexFlags_.end(), &s_compareIndexFlag);
+    std::sort(indexGroups_.begin(), indexGroups_.end(), &s_compareIndexFlag);
+    hasUsageIndex_ = true;
+}
+
+void Usage::writeFilteredUsage_(UsageWriter& writer, const std::string& pattern, enum eFilter filter,
+                                std::size_t first, std::size_t count) const {
+    if (!hasUsageIndex_) {
+        buildUsageIndex_();
+    }
+    std::vector<std::size_t> ordinals;
+    if (filter == FLAG_PREFIX) {
+        std::vector<std::pair<std::string, std::size_t> >::const_iterator it =
+            std::lower_bound(indexFlags_.begin(), indexFlags_.end(),
+                             std::pair<std::string, std::size_t>(pattern, 0), &s_compareIndexFlag);
+        for (; it != indexFlags_.end() && it->first.compare(0, pattern.size(), pattern) == 0; ++it) {
+            ordinals.push_back(it->second);
+        }
+    }
+    else if (filter == GROUP) {
+        std::vector<std::pair<std::string, std::size_t> >::const_iterator it =
+            std::lower_bound(indexGroups_.begin(), indexGroups_.end(),
+                             std::pair<std::string, std::size_t>(pattern, 0), &s_compareIndexFlag);
+        for (; it != indexGroups_.end() && it->first == pattern; ++it) {
+            ordinals.push_back(it->second);
+        }
+    }
+    else {
+        std::string lowerPattern = s_toLower(pattern);
+        std::size_t pos = indexHelp_.find(lowerPattern);
+        while (pos != std::string::npos && pos < indexHelp_.size()) {
+            // find the help of position
+            std::vector<std::pair<std::size_t, std::size_t> >::const_iterator it =
+                std::upper_bound(indexHelpOffsets_.begin(), indexHelpOffsets_.end(),
+                                 std::pair<std::size_t, std::size_t>(pos, static_cast<std::size_t>(-1)));
+            --it;
+            ordinals.push_back(it->second);
+            // next help
+            std::size_t nextHelp = indexHelp_.find('\0', pos);
+            pos = indexHelp_.find(lowerPattern, nextHelp + 1);
+        }
+    }
+    // usage order
+    std::sort(ordinals.begin(), ordinals.end());
+    ordinals.erase(std::unique(ordinals.begin(), ordinals.end()), ordinals.end());
+    for (std::size_t i = first; i < ordinals.size() && i - first < count; ++i) {
+        if (i != first) {
+            writer.write('\n');
+        }
+        Argument& argument = *indexArguments_[ordinals[i]];
+        writeArgumentUsage_(writer, argument, argumentOption_(argument));
+    }
+}
+
+void Usage::writeUsage_(UsageWriter& writer) const {
     bool hasOption = false;
     bool hasPositionnal = false;
     bool hasMultiLine = false;
@@ -69,22 +423,22 @@ std::string Usage::getUsage() const {
     }
     // usage line
     std::string usageLine = std::string("usage: ") + binaryName;
-    oss << usageLine;
+    writer.write(usageLine);
     std::size_t binaryPad = usageLine.size();
     std::size_t index = binaryPad;
     std::size_t indexMax = usagePadWidth_ + usageArgsWidth_ + usageSepWidth_ + usageHelpWidth_;
-    std::list<Argument*>::const_iterator it;
+    std::vector<Argument*>::const_iterator it;
     for (it = args_.arguments_.begin(); it != args_.arguments_.end(); ++it) {
         if ((*it)->isPositionnalArgument_()) {
             hasPositionnal = true;
             continue;
         }
         hasOption = true;
-        std::ostringstream ossArgument("");
+        std::string argument;
         if (!(*it)->isRequired_) {
-            ossArgument << '[';
+            argument += '[';
         }
-        ossArgument << (*it)->nameOrFlags_.front();
+        argument += (*it)->nameOrFlags_.front();
         switch ((*it)->type_) {
             case Argument::SIMPLE_OPTION:
             case Argument::NUMBER_OPTION:
@@ -93,37 +447,43 @@ std::string Usage::getUsage() const {
             case Argument::MULTI_INFINITE_OPTION:
             case Argument::MULTI_NUMBER_OPTION:
             case Argument::MULTI_NUMBER_INFINITE_OPTION:
-                if ((*it)->metavar_.empty()) {
-                    ossArgument << ' ' << (*it)->metavarDefault_();
+                argument += ' ';
+                if ((*it)->getMetavar().empty()) {
+                    argument += (*it)->metavarDefault_();
                 }
                 else {
-                    ossArgument << ' ' << (*it)->metavar_;
+                    argument += (*it)->getMetavar();
                 }
                 break;
             default:
                 break;
         }
         if (!(*it)->isRequired_) {
-            ossArgument << ']';
+            argument += ']';
         }
-        std::string argument = ossArgument.str();
         if (index + argument.size() >= indexMax) {
             hasMultiLine = true;
-            oss << '\n' << std::string(binaryPad + 1, ' ') << argument;
+            writer.write('\n');
+            writer.fill(' ', binaryPad + 1);
+            writer.write(argument);
             index = binaryPad + argument.size() + 1;
         }
         else {
-            oss << ' ' << argument;
+            writer.write(' ');
+            writer.write(argument);
             index += argument.size() + 1;
         }
     }
     if (hasOption && hasPositionnal) {
         if (hasMultiLine || index + 3 >= indexMax) {
-            oss << '\n' << std::string(binaryPad + 1, ' ') << "--\n" << std::string(binaryPad, ' ');
+            writer.write('\n');
+            writer.fill(' ', binaryPad + 1);
+            writer.write("--\n", sizeof("--\n") - 1);
+            writer.fill(' ', binaryPad);
             index = binaryPad;
         }
         else {
-            oss << " --";
+            writer.write(" --", sizeof(" --") - 1);
             index += 3;
         }
     }
@@ -131,184 +491,196 @@ std::string Usage::getUsage() const {
         if (!(*it)->isPositionnalArgument_()) {
             continue;
         }
-        std::ostringstream ossArgument("");
+        std::string argument;
         if (!(*it)->isRequired_) {
-            ossArgument << '[';
+            argument += '[';
         }
         if ((*it)->type_ == Argument::POSITIONAL_ARGUMENT) {
-            ossArgument << (*it)->nameOrFlags_.front();
+            argument += (*it)->nameOrFlags_.front();
         }
         else if ((*it)->type_ == Argument::NUMBER_POSITIONAL_ARGUMENT) {
             for (std::size_t i = 0; i < (*it)->nargs_; ++i) {
                 if (i != 0) {
-                    ossArgument << ' ';
+                    argument += ' ';
                 }
-                ossArgument << (*it)->nameOrFlags_.front();
+                argument += (*it)->nameOrFlags_.front();
             }
         }
         else if ((*it)->type_ == Argument::INFINITE_POSITIONAL_ARGUMENT) {
-            ossArgument << (*it)->nameOrFlags_.front() << " {" << (*it)->nameOrFlags_.front() << "}...";
+            argument += (*it)->nameOrFlags_.front();
+            argument += " {";
+            argument += (*it)->nameOrFlags_.front();
+            argument += "}...";
         }
         else if ((*it)->type_ == Argument::INFINITE_NUMBER_POSITIONAL_ARGUMENT) {
-            ossArgument << "{";
+            argument += '{';
             for (std::size_t i = 0; i < (*it)->nargs_; ++i) {
                 if (i != 0) {
-                    ossArgument << ' ';
+                    argument += ' ';
                 }
-                ossArgument << (*it)->nameOrFlags_.front();
+                argument += (*it)->nameOrFlags_.front();
             }
-            ossArgument << "}...";
+            argument += "}...";
         }
         if (!(*it)->isRequired_) {
-            ossArgument << ']';
+            argument += ']';
         }
-        std::string argument = ossArgument.str();
         if (index + argument.size() >= indexMax) {
             hasMultiLine = true;
-            oss << '\n' << std::string(binaryPad + 1, ' ') << argument;
+            writer.write('\n');
+            writer.fill(' ', binaryPad + 1);
+            writer.write(argument);
             index = binaryPad + argument.size() + 1;
         }
         else {
-            oss << ' ' << argument;
+            writer.write(' ');
+            writer.write(argument);
             index += argument.size() + 1;
         }
     }
+    if (!args_.subcommands_.empty()) {
+        const std::string argument("command ...");
+        if (index + argument.size() >= indexMax) {
+            writer.write('\n');
+            writer.fill(' ', binaryPad + 1);
+            writer.write(argument);
+        }
+        else {
+            writer.write(' ');
+            writer.write(argument);
+        }
+    }
     // description
     if (!description_.empty()) {
-        oss << '\n';
-        std::vector<std::string> lines = s_multilineWrap(description_, indexMax);
-        for (std::size_t i = 0; i < lines.size(); ++i) {
-            oss << '\n';
-            oss << lines[i];
+        writer.write('\n');
+        MultilineWrap wrap(description_, indexMax);
+        std::size_t offset;
+        std::size_t length;
+        while (wrap.next(&offset, &length)) {
+            writer.write('\n');
+            writer.write(description_.c_str() + offset, length);
         }
     }
     // optionnal
     if (!args_.arguments_.empty()) {
         if (hasPositionnal) {
             index = 0;
-            oss << "\n\npositional arguments:\n";
+            writer.write("\n\npositional arguments:\n", sizeof("\n\npositional arguments:\n") - 1);
             for (it = args_.arguments_.begin(); it != args_.arguments_.end(); ++it) {
                 if (!(*it)->isPositionnalArgument_()) {
                     continue;
                 }
                 if (index != 0) {
-                    oss << '\n';
+                    writer.write('\n');
                 }
                 ++index;
-                oss << std::string(usagePadWidth_, ' ');
-                if ((*it)->nameOrFlags_.front().size() + usageSepWidth_ <= usageArgsWidth_ + usageSepWidth_) {
-                    oss.width(usageArgsWidth_ + usageSepWidth_);
-                    oss.flags(std::ios::left);
-                    oss << (*it)->nameOrFlags_.front();
-                    oss.width(0);
-                }
-                else {
-                    oss << (*it)->nameOrFlags_.front();
-                    oss << '\n';
-                    oss << std::string(usagePadWidth_ + usageArgsWidth_ + usageSepWidth_, ' ');
-                }
-                std::ostringstream ossHelp("");
-                ossHelp << (*it)->help_;
-                if ((*it)->isRequired_) {
-                    ossHelp << " (required)";
-                }
-                else {
-                    if (!(*it)->default_.empty()) {
-                        ossHelp << " (default: " + (*it)->default_ + ")";
-                    }
-                }
-                std::vector<std::string> lines = s_multilineWrap(ossHelp.str(), usageHelpWidth_);
-                for (std::size_t i = 0; i < lines.size(); ++i) {
-                    if (i != 0) {
-                        oss << '\n';
-                        oss << std::string(usagePadWidth_ + usageArgsWidth_ + usageSepWidth_, ' ');
-                    }
-                    oss << lines[i];
-                }
+                writeArgumentUsage_(writer, **it, argumentOption_(**it));
             }
         }
         if (hasOption) {
             index = 0;
-            oss << "\n\noptional arguments:\n";
+            writer.write("\n\noptional arguments:\n", sizeof("\n\noptional arguments:\n") - 1);
             for (it = args_.arguments_.begin(); it != args_.arguments_.end(); ++it) {
                 if ((*it)->isPositionnalArgument_()) {
                     continue;
                 }
                 if (index != 0) {
-                    oss << '\n';
+                    writer.write('\n');
                 }
                 ++index;
-                std::ostringstream ossArgument("");
-                for (std::size_t i = 0; i < (*it)->nameOrFlags_.size(); ++i) {
-                    if (i != 0) {
-                        ossArgument << ", ";
-                    }
-                    ossArgument << (*it)->nameOrFlags_[i];
-                }
-                switch ((*it)->type_) {
-                    case Argument::SIMPLE_OPTION:
-                    case Argument::NUMBER_OPTION:
-                    case Argument::INFINITE_OPTION:
-                    case Argument::MULTI_OPTION:
-                    case Argument::MULTI_INFINITE_OPTION:
-                    case Argument::MULTI_NUMBER_OPTION:
-                    case Argument::MULTI_NUMBER_INFINITE_OPTION:
-                        if ((*it)->metavar_.empty()) {
-                            ossArgument << ' ';
-                            ossArgument << (*it)->metavarDefault_();
-                        }
-                        else {
-                            ossArgument << ' ';
-                            ossArgument << (*it)->metavar_;
-                        }
-                        break;
-                    default:
-                        break;
-                }
-                const std::string option = ossArgument.str();
-                oss << std::string(usagePadWidth_, ' ');
-                if (option.size() + usageSepWidth_ <= usageArgsWidth_ + usageSepWidth_) {
-                    oss.width(usageArgsWidth_ + usageSepWidth_);
-                    oss.flags(std::ios::left);
-                    oss << option;
-                    oss.width(0);
-                }
-                else {
-                    oss << option;
-                    oss << '\n';
-                    oss << std::string(usagePadWidth_ + usageArgsWidth_ + usageSepWidth_, ' ');
-                }
-                std::ostringstream ossHelp("");
-                ossHelp << (*it)->help_;
-                if ((*it)->isRequired_) {
-                    ossHelp << " (required)";
-                }
-                else {
-                    if (!(*it)->default_.empty()) {
-                        ossHelp << " (default: " + (*it)->default_ + ")";
-                    }
-                }
-                std::vector<std::string> lines = s_multilineWrap(ossHelp.str(), usageHelpWidth_);
-                for (std::size_t i = 0; i < lines.size(); ++i) {
-                    if (i != 0) {
-                        oss << '\n';
-                        oss << std::string(usagePadWidth_ + usageArgsWidth_ + usageSepWidth_, ' ');
-                    }
-                    oss << lines[i];
-                }
+                writeArgumentUsage_(writer, **it, argumentOption_(**it));
             }
         }
     }
+    // subcommands
+    if (!args_.subcommands_.empty()) {
+        writer.write("\n\ncommands:\n", sizeof("\n\ncommands:\n") - 1);
+        for (std::size_t i = 0; i < args_.subcommands_.size(); ++i) {
+            if (i != 0) {
+                writer.write('\n');
+            }
+            writeUsageLine_(writer, args_.subcommands_[i].name, args_.subcommands_[i].help);
+        }
+    }
     // epilog
     if (!epilog_.empty()) {
-        oss << '\n';
-        std::vector<std::string> lines = s_multilineWrap(epilog_, indexMax);
-        for (std::size_t i = 0; i < lines.size(); ++i) {
-            oss << '\n';
-            oss << lines[i];
+        writer.write('\n');
+        MultilineWrap wrap(epilog_, indexMax);
+        std::size_t offset;
+        std::size_t length;
+        while (wrap.next(&offset, &length)) {
+            writer.write('\n');
+            writer.write(epilog_.c_str() + offset, length);
+        }
+    }
+}
+
+std::string Usage::argumentOption_(Argument& argument) const {
+    if (argument.isPositionnalArgument_()) {
+        return argument.nameOrFlags_.front();
+    }
+    std::string option;
+    for (std::size_t i = 0; i < argument.nameOrFlags_.size(); ++i) {
+        if (i != 0) {
+            option += ", ";
+        }
+        option += argument.nameOrFlags_[i];
+    }
+    switch (argument.type_) {
+        case Argument::SIMPLE_OPTION:
+        case Argument::NUMBER_OPTION:
+        case Argument::INFINITE_OPTION:
+        case Argument::MULTI_OPTION:
+        case Argument::MULTI_INFINITE_OPTION:
+        case Argument::MULTI_NUMBER_OPTION:
+        case Argument::MULTI_NUMBER_INFINITE_OPTION:
+            option += ' ';
+            if (argument.getMetavar().empty()) {
+                option += argument.metavarDefault_();
+            }
+            else {
+                option += argument.getMetavar();
+            }
+            break;
+        default:
+            break;
+    }
+    return option;
+}
+
+void Usage::writeArgumentUsage_(UsageWriter& writer, const Argument& argument, const std::string& option) const {
+    std::string help = argument.getHelp();
+    if (argument.isRequired_) {
+        help += " (required)";
+    }
+    else {
+        if (argument.hasDefault_()) {
+            help += " (default: " + argument.getDefault() + ")";
+        }
+    }
+    writeUsageLine_(writer, option, help);
+}
+
+void Usage::writeUsageLine_(UsageWriter& writer, const std::string& option, const std::string& help) const {
+    writer.fill(' ', usagePadWidth_);
+    writer.write(option);
+    if (option.size() <= usageArgsWidth_) {
+        writer.fill(' ', usageArgsWidth_ + usageSepWidth_ - option.size());
+    }
+    else {
+        writer.write('\n');
+        writer.fill(' ', usagePadWidth_ + usageArgsWidth_ + usageSepWidth_);
+    }
+    MultilineWrap wrap(help, usageHelpWidth_);
+    std::size_t offset;
+    std::size_t length;
+    for (std::size_t i = 0; wrap.next(&offset, &length); ++i) {
+        if (i != 0) {
+            writer.write('\n');
+            writer.fill(' ', usagePadWidth_ + usageArgsWidth_ + usageSepWidth_);
         }
+        writer.write(help.c_str() + offset, length);
     }
-    return oss.str();
 }
 
 } // namespace args
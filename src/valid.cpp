@@ -27,6 +27,7 @@
 
 #include <sys/stat.h>
 
+#include <algorithm>
 #include <cstdlib>
 #include <sstream>
 
@@ -101,8 +102,34 @@ bool ValidMinMax::isValid(std::vector<std::string>& args) {
 ################################################################################
 */
 
+/**
+ * @brief Compare the choises from their indexes
+ */
+class ChoiseCompare {
+  public:
+    ChoiseCompare(const std::vector<std::string>& choises) :
+        choises_(choises) {}
+
+    bool operator()(std::size_t first, std::size_t second) const {
+        return choises_[first] < choises_[second];
+    }
+
+    bool operator()(std::size_t index, const std::string& prefix) const {
+        return choises_[index] < prefix;
+    }
+
+  private:
+    const std::vector<std::string>& choises_;
+};
+
 ValidChoise::ValidChoise(const std::vector<std::string>& choises) :
-    choises_(choises) {}
+    choises_(choises),
+    sortedChoises_(choises.size()) {
+    for (std::size_t i = 0; i < sortedChoises_.size(); ++i) {
+        sortedChoises_[i] = i;
+    }
+    std::sort(sortedChoises_.begin(), sortedChoises_.end(), ChoiseCompare(choises_));
+}
 
 ValidChoise::~ValidChoise() {}
 
@@ -130,6 +157,16 @@ bool ValidChoise::isValid(std::vector<std::string>& args) {
     return true;
 }
 
+void ValidChoise::complete(const std::string& prefix, std::vector<std::string>* candidates) const {
+    // the choises which start by prefix follow the lower bound
+    std::vector<std::size_t>::const_iterator it =
+        std::lower_bound(sortedChoises_.begin(), sortedChoises_.end(), prefix, ChoiseCompare(choises_));
+    while (it != sortedChoises_.end() && choises_[*it].compare(0, prefix.size(), prefix) == 0) {
+        candidates->push_back(choises_[*it]);
+        ++it;
+    }
+}
+
 /*
 ################################################################################
  ValidPath
@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 
+#include "argsTable.h"
 #include "blet/args.h"
 
 GTEST_TEST(addArgument, argumentException) {
@@ -260,3 +261,137 @@ GTEST_TEST(addArgument, positionnal) {
     args.addArgument("ARG").action(args.NONE).action(args.INFINITE).nargs(4).nargs(1);
     EXPECT_EQ(args["ARG"].getAction(), args.INFINITE);
 }
+
+GTEST_TEST(addArgument, move) {
+    std::vector<std::string> flags;
+    flags.push_back("-m");
+    flags.push_back("--multi");
+    std::vector<std::string> defaults;
+    defaults.push_back("1");
+    defaults.push_back("2");
+    defaults.push_back("3");
+    defaults.push_back("4");
+    blet::Args args;
+    args.addArgument(std::move(flags)).action(blet::Args::APPEND).nargs(2).defaults(std::move(defaults));
+    EXPECT_EQ(args["--multi"].getString(), "(1, 2), (3, 4)");
+    EXPECT_EQ(args["-m"].getDefault(), "(1, 2), (3, 4)");
+    EXPECT_THROW(args.addArgument(std::string("--multi")), blet::Args::ArgumentException);
+
+    const char* argv[] = {"binaryName", "-m", "5", "6", "--multi", "7", "8"};
+    const int argc = sizeof(argv) / sizeof(*argv);
+    args.parseArguments(argc, const_cast<char**>(argv));
+    blet::args::ArgumentElement source(args["-m"][1]);
+    blet::args::ArgumentElement element(std::move(source));
+    EXPECT_TRUE(source.empty());
+    ASSERT_EQ(element.size(), 2);
+    EXPECT_EQ(element[0].getString(), "7");
+    EXPECT_EQ(element[1].getNumber(), 8);
+    blet::args::ArgumentElement copy;
+    copy = element;
+    EXPECT_EQ(copy.getString(), element.getString());
+    EXPECT_EQ(copy[1].getString(), "8");
+}
+
+GTEST_TEST(addArgument, memoryUsage) {
+    blet::Args args(false);
+    std::size_t emptyUsage = args.memoryUsage();
+    EXPECT_GE(emptyUsage, sizeof(blet::Args));
+    args.addArgument("-n").nargs(2).defaults({"1", "2"}).help("a help message longer than a small string");
+    std::size_t usage = args.memoryUsage();
+    EXPECT_GE(usage, emptyUsage + sizeof(blet::args::Argument) + 2 * sizeof(blet::args::ArgumentElement));
+    EXPECT_EQ(args["-n"].getDefault(), "1, 2");
+    EXPECT_EQ(&args["-n"].getDefault(), &args["-n"].getDefault());
+    EXPECT_TRUE(args["-n"][1].isNumber());
+    EXPECT_EQ(args["-n"][1].getNumber(), 2);
+    EXPECT_FALSE(args["-n"].isNumber());
+    args.addArgument("--foo");
+    EXPECT_GT(args.memoryUsage(), usage);
+    args.clear();
+    EXPECT_LT(args.memoryUsage(), usage);
+}
+
+GTEST_TEST(addArgument, table) {
+    const char* argv[] = {"binaryName", "-va", "foo", "--number", "3", "4", "--append=bar", "file1", "file2"};
+    blet::Args args;
+    args.addArguments(argsTable);
+    EXPECT_EQ(args["--verbose"].getAction(), blet::Args::STORE_TRUE);
+    EXPECT_EQ(args["-v"].getHelp(), std::string("verbose mode"));
+    EXPECT_EQ(args["--append"].getHelp(), std::string("\"quoted\" help"));
+    EXPECT_EQ(args["-n"].getMetavar(), std::string("N"));
+    EXPECT_EQ(args["-n"].getString(), std::string("1, 2"));
+    EXPECT_EQ(args["FILE"].isRequired(), true);
+    args.parseArguments(sizeof(argv) / sizeof(*argv), const_cast<char**>(argv));
+    EXPECT_EQ(args["-v"].isExists(), true);
+    EXPECT_EQ(args["-a"].getString(), std::string("foo, bar"));
+    EXPECT_EQ(args["-n"].getString(), std::string("3, 4"));
+    EXPECT_EQ(args["FILE"].getString(), std::string("file1, file2"));
+    EXPECT_THROW(args.addArguments(argsTable), blet::Args::ArgumentException);
+    args.removeArguments("-v");
+    const char* argv2[] = {"binaryName", "--verbose", "file1"};
+    args.parseArguments(sizeof(argv2) / sizeof(*argv2), const_cast<char**>(argv2));
+    EXPECT_EQ(args["--verbose"].isExists(), true);
+    EXPECT_EQ(args.argumentExists("-v"), false);
+}
+
+GTEST_TEST(addArgument, tableRollback) {
+    static const char* const xFlags[] = {"-x", "--xx"};
+    static const char* const helpFlags[] = {"-H", "--hh"};
+    static const char* const fileNames[] = {"FILE"};
+    static const blet::args::TableArgument helpArguments[] = {
+        {xFlags, 2, blet::args::Action::STORE_TRUE, 1, NULL, 0, NULL, NULL, false},
+        {helpFlags, 2, blet::args::Action::HELP, 1, NULL, 0, NULL, NULL, false},
+    };
+    static const blet::args::TableArgument positionalArguments[] = {
+        {xFlags, 2, blet::args::Action::STORE_TRUE, 1, NULL, 0, NULL, NULL, false},
+        {fileNames, 1, blet::args::Action::STORE_TRUE, 1, NULL, 0, NULL, NULL, false},
+    };
+    const blet::args::Table helpTable = {helpArguments, 2, NULL, 0, NULL, 0, NULL};
+    const blet::args::Table positionalTable = {positionalArguments, 2, NULL, 0, NULL, 0, NULL};
+    blet::Args args;
+    args.setBinaryName("binaryName");
+    std::string usage = args.getUsage();
+    // help action already defined
+    EXPECT_THROW(args.addArguments(helpTable), blet::Args::ArgumentException);
+    EXPECT_EQ(args.getUsage(), usage);
+    EXPECT_EQ(args.argumentExists("--xx"), false);
+    // positional argument cannot use with this action
+    EXPECT_THROW(args.addArguments(positionalTable), blet::Args::ArgumentException);
+    EXPECT_EQ(args.getUsage(), usage);
+    EXPECT_EQ(args.argumentExists("--xx"), false);
+    EXPECT_EQ(args.argumentExists("FILE"), false);
+    args.addArgument("-x").flag("--xx").action(blet::Args::STORE_TRUE);
+    usage = args.getUsage();
+    EXPECT_EQ(usage.find("-x, --xx"), usage.rfind("-x, --xx"));
+    EXPECT_EQ(usage.find("--hh"), std::string::npos);
+}
+
+#if __cplusplus >= 201703L
+GTEST_TEST(addArgument, spec) {
+    constexpr auto spec = blet::Args::spec(
+        blet::Args::option("-v").flag("--verbose").action(blet::Args::STORE_TRUE).help("verbose mode"),
+        blet::Args::option("--number").nargs(2).defaults("1", "2").metavar("N"),
+        blet::Args::option("FILE").nargs('+').required());
+    static_assert(spec.size() == 3);
+    static_assert(spec[1].getNargs() == 2);
+    blet::Args args;
+    args.addArguments(spec);
+    EXPECT_EQ(args["--verbose"].getAction(), blet::Args::STORE_TRUE);
+    EXPECT_EQ(args["-v"].getHelp(), std::string("verbose mode"));
+    EXPECT_EQ(args["--number"].getMetavar(), std::string("N"));
+    EXPECT_EQ(args["--number"].getString(), std::string("1, 2"));
+    EXPECT_EQ(args["FILE"].getAction(), blet::Args::INFINITE);
+    EXPECT_EQ(args["FILE"].isRequired(), true);
+    EXPECT_THROW(args.addArguments(blet::Args::spec(blet::Args::option("-v"))), blet::Args::ArgumentException);
+    // nothing is added if the spec conflicts with this object
+    EXPECT_THROW(args.addArguments(blet::Args::spec(blet::Args::option("--other"),
+                                                    blet::Args::option("--usage").action(blet::Args::HELP))),
+                 blet::Args::ArgumentException);
+    EXPECT_FALSE(args.argumentExists("--other"));
+    EXPECT_THROW(blet::Args::option("-foo"), blet::Args::ArgumentException);
+    EXPECT_THROW(blet::Args::option("-a").flag("-a"), blet::Args::ArgumentException);
+    EXPECT_THROW(blet::Args::option("ARG").action(blet::Args::STORE_TRUE), blet::Args::ArgumentException);
+    EXPECT_THROW(blet::Args::option("--arg").nargs(2).defaults("1"), blet::Args::ArgumentException);
+    EXPECT_THROW(blet::Args::spec(blet::Args::option("-a"), blet::Args::option("--b").flag("-a")),
+                 blet::Args::ArgumentException);
+}
+#endif
@@ -0,0 +1,17 @@
+# spec of addArgument.table test
+[-v --verbose]
+action = store_true
+help = verbose mode
+
+[-n --number]
+nargs = 2
+defaults = 1 2
+metavar = N
+
+[-a --append]
+action = append
+help = "quoted" help
+
+[FILE]
+nargs = +
+required = true
@@ -1,4 +1,6 @@
 #include <gtest/gtest.h>
+#include <stdexcept>
+#include <unistd.h>
 
 #include "blet/args.h"
 
@@ -8,6 +10,33 @@ GTEST_TEST(getUsage, custom) {
     EXPECT_EQ(args.getUsage(), std::string("foo"));
 }
 
+GTEST_TEST(getUsage, cache) {
+    blet::Args args;
+    args.setBinaryName("binaryName");
+    args.addArgument("--option").help("help of option");
+    const std::string& usage = args.getUsage();
+    EXPECT_EQ(&usage, &args.getUsage());
+    EXPECT_EQ(usage, "usage: binaryName [-h] [--option OPTION]\n"
+                     "\n"
+                     "optional arguments:\n"
+                     "  -h, --help            show this help message and exit\n"
+                     "  --option OPTION       help of option");
+    args.updateArgument("--option").help("new help").metavar("VALUE");
+    EXPECT_EQ(args.getUsage(), "usage: binaryName [-h] [--option VALUE]\n"
+                               "\n"
+                               "optional arguments:\n"
+                               "  -h, --help            show this help message and exit\n"
+                               "  --option VALUE        new help");
+    args.removeArguments("--option");
+    args.setDescription("description");
+    EXPECT_EQ(args.getUsage(), "usage: binaryName [-h]\n"
+                               "\n"
+                               "description\n"
+                               "\n"
+                               "optional arguments:\n"
+                               "  -h, --help            show this help message and exit");
+}
+
 GTEST_TEST(getUsage, compareOption_) {
     blet::Args args(false);
     args.addArgument(args.vector("-h", "--help")).action(blet::Args::HELP).help("custom help option message");
@@ -221,3 +250,134 @@ GTEST_TEST(getUsage, allTypeArgument) {
 
     EXPECT_EQ(args.getUsage(), usage.str());
 }
+
+GTEST_TEST(getUsage, utf8Wrap) {
+    blet::Args args;
+    args.setBinaryName("binaryName");
+    args.setUsageWidth(2, 10, 2, 7);
+    args.addArgument("-a").action(args.STORE_TRUE).help("\xc3\xa9\xc3\xa9\xc3\xa9 \xc3\xa9\xc3\xa9\xc3\xa9 \xc3\xa9\xc3\xa9\xc3\xa9");
+    args.addArgument("-b").action(args.STORE_TRUE).help("\xe6\x97\xa5\xe6\x9c\xac \xe6\x97\xa5\xe6\x9c\xac");
+    EXPECT_EQ(args.getUsage(), "usage: binaryName\n"
+                               "                  [-a]\n"
+                               "                  [-b]\n"
+                               "                  [-h]\n"
+                               "\n"
+                               "optional arguments:\n"
+                               "  -a          \xc3\xa9\xc3\xa9\xc3\xa9 \xc3\xa9\xc3\xa9\xc3\xa9\n"
+                               "              \xc3\xa9\xc3\xa9\xc3\xa9\n"
+                               "  -b          \xe6\x97\xa5\xe6\x9c\xac\n"
+                               "              \xe6\x97\xa5\xe6\x9c\xac\n"
+                               "  -h, --help  show\n"
+                               "              this\n"
+                               "              help\n"
+                               "              message\n"
+                               "              and\n"
+                               "              exit");
+}
+
+static void s_sinkToVector(void* user, const char* str, std::size_t size) {
+    static_cast<std::vector<std::string>*>(user)->push_back(std::string(str, size));
+}
+
+static void s_sinkThrow(void* /*user*/, const char* /*str*/, std::size_t /*size*/) {
+    throw std::runtime_error("sink");
+}
+
+GTEST_TEST(getUsage, writeUsage) {
+    blet::Args args;
+    args.setBinaryName("binaryName");
+    for (std::size_t i = 0; i < 200; ++i) {
+        std::ostringstream oss("");
+        oss << "--option" << i;
+        args.addArgument(oss.str()).help("help of option with a long text for wrap the line of help message");
+    }
+    std::vector<std::string> parts;
+    args.writeUsage(&s_sinkToVector, &parts);
+    // flushed by fixed size buffers
+    EXPECT_GT(parts.size(), 1);
+    std::string usage;
+    for (std::size_t i = 0; i < parts.size(); ++i) {
+        EXPECT_LE(parts[i].size(), 4096);
+        usage += parts[i];
+    }
+    EXPECT_EQ(usage, args.getUsage());
+
+    char path[] = "/tmp/blet_args_usage_XXXXXX";
+    int fd = ::mkstemp(path);
+    ASSERT_NE(fd, -1);
+    ::unlink(path);
+    args.writeUsage(fd);
+    std::string content(usage.size() + 1, '\0');
+    ::lseek(fd, 0, SEEK_SET);
+    EXPECT_EQ(::read(fd, &content[0], content.size()), static_cast<ssize_t>(usage.size()));
+    ::close(fd);
+    content.resize(usage.size());
+    EXPECT_EQ(content, usage);
+    // the exception of a sink is thrown in the middle of the usage or by the last flush
+    args.setDescription("description");
+    EXPECT_THROW(args.writeUsage(&s_sinkThrow, NULL), std::runtime_error);
+    blet::Args small;
+    EXPECT_THROW(small.writeUsage(&s_sinkThrow, NULL), std::runtime_error);
+}
+
+GTEST_TEST(getUsage, filter) {
+    blet::Args args;
+    args.addArgument("--net-timeout").metavar("SEC").help("Network timeout");
+    args.addArgument("--net-retry").action(args.STORE_TRUE).help("retry on error");
+    args.addArgument(args.vector("-c", "--cache")).action(args.STORE_TRUE).help("enable the Cache");
+    args.addArgument("FILE").help("file to read in cache");
+    EXPECT_EQ(args.getUsage("--net", args.FLAG_PREFIX), "  --net-retry           retry on error\n"
+                                                         "  --net-timeout SEC     Network timeout");
+    // one line by argument
+    EXPECT_EQ(args.getUsage("-", args.FLAG_PREFIX, 1, 2), "  -h, --help            show this help message and exit\n"
+                                                          "  --net-retry           retry on error");
+    EXPECT_EQ(args.getUsage("cache", args.HELP_SEARCH), "  -c, --cache           enable the Cache\n"
+                                                        "  FILE                  file to read in cache");
+    EXPECT_EQ(args.getUsage("network", args.HELP_SEARCH), "  --net-timeout SEC     Network timeout");
+    EXPECT_EQ(args.getUsage("", args.HELP_SEARCH, 3), "  --net-timeout SEC     Network timeout\n"
+                                                      "  FILE                  file to read in cache");
+    EXPECT_EQ(args.getUsage("--not", args.FLAG_PREFIX), "");
+    // index is rebuilt after a change
+    args.updateArgument("--net-retry").help("network retry");
+    EXPECT_EQ(args.getUsage("network", args.HELP_SEARCH, 0, 1), "  --net-retry           network retry");
+    // exact group in usage order
+    args.updateArgument("--net-timeout").group("network");
+    args.updateArgument("--net-retry").group("network");
+    args.updateArgument("--cache").group("net");
+    EXPECT_EQ(args.getArgument("--cache").getGroup(), "net");
+    EXPECT_EQ(args.getUsage("network", args.GROUP), "  --net-retry           network retry\n"
+                                                    "  --net-timeout SEC     Network timeout");
+    EXPECT_EQ(args.getUsage("network", args.GROUP, 1), "  --net-timeout SEC     Network timeout");
+    EXPECT_EQ(args.getUsage("net", args.GROUP), "  -c, --cache           enable the Cache");
+    EXPECT_EQ(args.getUsage("", args.GROUP), "");
+}
+
+static std::size_t s_helpCallCount = 0;
+
+static std::string s_getHelp() {
+    ++s_helpCallCount;
+    return "help from function";
+}
+
+GTEST_TEST(getUsage, lazyHelp) {
+    char help[] = "literal help";
+    char metavar[] = "VALUE";
+    blet::Args args;
+    args.setBinaryName("binaryName");
+    args.setLiteralHelp();
+    args.addArgument("--literal").help(help).metavar(metavar);
+    args.addArgument("--function").action(args.STORE_TRUE).help(&s_getHelp);
+    // not copied
+    help[0] = 'L';
+    metavar[0] = 'v';
+    EXPECT_EQ(s_helpCallCount, 0);
+    EXPECT_EQ(args.getUsage(), "usage: binaryName [-h] [--function] [--literal vALUE]\n"
+                               "\n"
+                               "optional arguments:\n"
+                               "  -h, --help            show this help message and exit\n"
+                               "  --function            help from function\n"
+                               "  --literal vALUE       Literal help");
+    EXPECT_EQ(s_helpCallCount, 1);
+    EXPECT_EQ(args["--function"].getHelp(), "help from function");
+    EXPECT_EQ(args["--literal"].getHelp(), "Literal help");
+}
@@ -0,0 +1,141 @@
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <unistd.h>
+
+#include "blet/args.h"
+
+static std::string s_tmpFilename() {
+    char filename[] = "/tmp/blet_args_snapshot_XXXXXX";
+    int fd = ::mkstemp(filename);
+    ::close(fd);
+    return filename;
+}
+
+static std::string s_getHelp() {
+    return "help from function";
+}
+
+GTEST_TEST(loadSnapshot, usage) {
+    const char* argv[] = {"binaryName", "-vn", "3", "4", "--append=foo", "-a", "bar", "file1", "file2"};
+    std::string filename = s_tmpFilename();
+    std::string usage;
+    {
+        blet::Args args;
+        args.setBinaryName("binaryName");
+        args.setDescription("description");
+        args.setEpilog("epilog");
+        args.setVersion("1.0.0");
+        args.addArgument({"-v", "--verbose"}).action(args.STORE_TRUE).help("verbose mode");
+        args.addArgument({"-n", "--number"}).nargs(2).defaults({"1", "2"}).metavar("N");
+        args.addArgument({"-a", "--append"}).action(args.APPEND).help(&s_getHelp);
+        args.addArgument("--version").action(args.VERSION);
+        args.addArgument("FILE").nargs('+').required();
+        usage = args.getUsage();
+        args.saveSnapshot(filename.c_str());
+    }
+    blet::Args args(false);
+    args.setBinaryName("binaryName");
+    args.loadSnapshot(filename.c_str());
+    ::unlink(filename.c_str());
+    EXPECT_EQ(args.getUsage(), usage);
+    EXPECT_EQ(args.getVersion(), std::string("1.0.0"));
+    EXPECT_EQ(args["-a"].getHelp(), std::string("help from function"));
+    EXPECT_EQ(args["--number"].getString(), std::string("1, 2"));
+    args.parseArguments(sizeof(argv) / sizeof(*argv), const_cast<char**>(argv));
+    EXPECT_EQ(args["--verbose"].isExists(), true);
+    EXPECT_EQ(args["-n"].getString(), std::string("3, 4"));
+    EXPECT_EQ(args["-a"].getString(), std::string("foo, bar"));
+    EXPECT_EQ(args["FILE"].getString(), std::string("file1, file2"));
+    EXPECT_THROW(args.addArgument("--number"), blet::Args::ArgumentException);
+    args.removeArguments("-v");
+    EXPECT_EQ(args.argumentExists("-v"), false);
+    EXPECT_EQ(args.argumentExists("--verbose"), true);
+    EXPECT_EQ(args.argumentExists("-n"), true);
+}
+
+GTEST_TEST(loadSnapshot, exception) {
+    std::string filename = s_tmpFilename();
+    {
+        blet::Args args;
+        args.saveSnapshot(filename.c_str());
+    }
+    blet::Args args;
+    EXPECT_THROW(
+        {
+            try {
+                args.loadSnapshot(filename.c_str());
+            }
+            catch (const blet::Args::ArgumentException& e) {
+                EXPECT_STREQ(e.what(), "invalid flag already exist");
+                throw;
+            }
+        },
+        blet::Args::ArgumentException);
+    {
+        std::ofstream ofs(filename.c_str());
+        ofs << "not a snapshot";
+    }
+    EXPECT_THROW(
+        {
+            try {
+                args.loadSnapshot(filename.c_str());
+            }
+            catch (const blet::Args::Exception& e) {
+                EXPECT_STREQ(e.what(), "invalid snapshot");
+                throw;
+            }
+        },
+        blet::Args::Exception);
+    ::unlink(filename.c_str());
+    EXPECT_THROW(args.loadSnapshot(filename.c_str()), blet::Args::Exception);
+}
+
+GTEST_TEST(loadSnapshot, corrupted) {
+    const char* argv[] = {"binaryName", "-v", "--number", "1", "2", "-a", "foo"};
+    std::string filename = s_tmpFilename();
+    {
+        blet::Args args(false);
+        args.addArgument({"-v", "--verbose"}).action(args.STORE_TRUE).help("verbose mode");
+        args.addArgument({"-n", "--number"}).nargs(2).defaults({"1", "2"}).metavar("N");
+        args.saveSnapshot(filename.c_str());
+    }
+    std::string snapshot;
+    {
+        std::ifstream ifs(filename.c_str(), std::ios::binary);
+        snapshot.assign(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+    }
+    ASSERT_FALSE(snapshot.empty());
+    // each byte is flipped, the load throws or defines usable arguments
+    const unsigned char masks[] = {0x01, 0x80, 0xFF};
+    for (std::size_t i = 0; i < snapshot.size(); ++i) {
+        for (std::size_t j = 0; j < sizeof(masks); ++j) {
+            std::string corrupted(snapshot);
+            corrupted[i] = static_cast<char>(corrupted[i] ^ masks[j]);
+            {
+                std::ofstream ofs(filename.c_str(), std::ios::binary | std::ios::trunc);
+                ofs.write(corrupted.data(), corrupted.size());
+            }
+            blet::Args args(false);
+            args.setHelpException();
+            args.setVersionException();
+            args.addArgument("-a");
+            try {
+                args.loadSnapshot(filename.c_str());
+            }
+            catch (const blet::Args::Exception&) {
+                EXPECT_EQ(args.argumentExists("-a"), true);
+                continue;
+            }
+            try {
+                args.getUsage();
+                args.parseArguments(sizeof(argv) / sizeof(*argv), const_cast<char**>(argv));
+            }
+            catch (const blet::Args::Exception&) {
+            }
+        }
+    }
+    ::unlink(filename.c_str());
+}
@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 #include <sys/stat.h>
+#include <unistd.h>
 
 #include "blet/args.h"
 #include "mock/mockc.h"
@@ -472,6 +473,26 @@ GTEST_TEST(parseArguments, argumentNumber) {
     EXPECT_EQ(args["argument"][2].getNumber(), 2);
 }
 
+GTEST_TEST(parseArguments, isNumber) {
+    const char* argv[] = {"binaryName", "42", "-1.5e3", ".5", " 7", "0x10", "nan", "inf", "1e5x", "1234aaa", "1e", "."};
+    const int argc = sizeof(argv) / sizeof(*argv);
+
+    blet::Args args;
+    args.addArgument("argument").action(blet::Args::INFINITE);
+    args.parseArguments(argc, const_cast<char**>(argv));
+    const blet::args::Argument& argument = args["argument"];
+    ASSERT_EQ(argument.size(), 11);
+    EXPECT_EQ(argument[0].getNumber(), 42);
+    EXPECT_EQ(argument[1].getNumber(), -1500);
+    EXPECT_EQ(argument[2].getNumber(), 0.5);
+    EXPECT_EQ(argument[3].getNumber(), 7);
+    // only the whole decimal strings are numbers
+    for (std::size_t i = 4; i < argument.size(); ++i) {
+        EXPECT_EQ(argument[i].isNumber(), false) << argument[i].getString();
+        EXPECT_THROW(argument[i].getNumber(), blet::Args::Exception);
+    }
+}
+
 GTEST_TEST(parseArguments, argumentInfinite) {
     const char* argv[] = {"binaryName", "0", "1", "2", "-b"};
     const int argc = sizeof(argv) / sizeof(*argv);
@@ -503,6 +524,80 @@ GTEST_TEST(parseArguments, argumentInfiniteNumber) {
     EXPECT_EQ(args["argument"][1][2].getNumber(), 2);
 }
 
+GTEST_TEST(parseArguments, values) {
+    const char* argv[] = {"binaryName", "0", "1", "2", "3", "4", "5", "--option", "foo", "--infinite", "a", "b"};
+    const int argc = sizeof(argv) / sizeof(*argv);
+
+    blet::Args args;
+    args.addArgument("argument").nargs('+').nargs(3);
+    args.addArgument("--option");
+    args.addArgument("--infinite").action(args.INFINITE);
+    args.addArgument("--empty").action(args.INFINITE);
+    args.addArgument("-b").action(args.STORE_TRUE);
+    args.parseArguments(argc, const_cast<char**>(argv));
+
+    std::vector<std::string> values;
+    for (blet::Args::StringView value : args["argument"].values()) {
+        values.push_back(value);
+    }
+    EXPECT_EQ(values, args["argument"].operator std::vector<std::string>());
+    std::size_t groupCount = 0;
+    for (blet::Args::ValueRange group : args["argument"].groups()) {
+        std::size_t i = 0;
+        for (blet::Args::ValueRange::iterator it = group.begin(); it != group.end(); ++it) {
+            EXPECT_EQ(*it, args["argument"][groupCount][i].getString());
+            ++i;
+        }
+        EXPECT_EQ(i, 3);
+        ++groupCount;
+    }
+    EXPECT_EQ(groupCount, 2);
+
+    blet::Args::ValueRange option = args["--option"].values();
+    ASSERT_NE(option.begin(), option.end());
+    EXPECT_EQ(*option.begin(), "foo");
+    EXPECT_EQ(++option.begin(), option.end());
+
+    values.clear();
+    for (blet::Args::StringView value : args["--infinite"].values()) {
+        values.push_back(value);
+    }
+    ASSERT_EQ(values.size(), 2);
+    EXPECT_EQ(values[0], "a");
+    EXPECT_EQ(values[1], "b");
+
+    EXPECT_EQ(args["--empty"].values().begin(), args["--empty"].values().end());
+    EXPECT_THROW(args["-b"].values(), blet::Args::Exception);
+    EXPECT_THROW(args["--option"].groups(), blet::Args::Exception);
+}
+
+GTEST_TEST(parseArguments, getString) {
+    blet::Args args;
+    args.addArgument("--number").nargs(2).action(args.APPEND);
+    args.addArgument("--infinite").action(args.INFINITE).defaults(args.vector("x", "y"));
+    args.addArgument("-b").action(args.STORE_TRUE);
+    EXPECT_EQ(args["--infinite"].getString(), "x, y");
+    {
+        const char* argv[] = {"binaryName", "--number", "0", "1", "--number", "2", "3", "--infinite", "a", "b"};
+        const int argc = sizeof(argv) / sizeof(*argv);
+        args.parseArguments(argc, const_cast<char**>(argv));
+        EXPECT_EQ(args["--number"].getString(), "(0, 1), (2, 3)");
+        EXPECT_EQ(args["--infinite"].getString(), "a, b");
+        EXPECT_EQ(args["-b"].getString(), "false");
+        // same rendering
+        EXPECT_EQ(&args["--number"].getString(), &args["--number"].getString());
+    }
+    {
+        // new parse renders again
+        const char* argv[] = {"binaryName", "--number", "4", "5", "--infinite", "c", "-b"};
+        const int argc = sizeof(argv) / sizeof(*argv);
+        args.parseArguments(argc, const_cast<char**>(argv));
+        EXPECT_EQ(args["--number"].getString(), "(4, 5)");
+        EXPECT_EQ(args["--infinite"].getString(), "c");
+        EXPECT_EQ(args["-b"].getString(), "true");
+    }
+}
+
 GTEST_TEST(parseArguments, help) {
     const char* argv[] = {"binaryName", "--help"};
     const int argc = sizeof(argv) / sizeof(*argv);
@@ -536,6 +631,16 @@ GTEST_TEST(parseArguments, help) {
                               "optional arguments:\n"
                               "  -h, --help            show this help message and exit\n"));
     }
+    {
+        // the help follows the redirection of std::cout
+        blet::Args args;
+        EXPECT_EXIT(
+            {
+                std::cout.rdbuf(std::cerr.rdbuf());
+                args.parseArguments(argc, const_cast<char**>(argv));
+            },
+            ::testing::ExitedWithCode(0), "usage: binaryName \\[-h\\]");
+    }
 }
 
 GTEST_TEST(parseArguments, version) {
@@ -671,6 +776,42 @@ GTEST_TEST(parseArguments, validException) {
             },
             blet::Args::ParseArgumentValidException);
     }
+    {
+        // the arguments are checked in the order of usage, not in the order of creation
+        const char* argvOrder[] = {"binaryName", "--zzz", "foo", "--aaa", "bar"};
+        const int argcOrder = sizeof(argvOrder) / sizeof(*argvOrder);
+        blet::Args args;
+        args.addArgument("--zzz").nargs(1).valid(new FailedTest());
+        args.addArgument("--aaa").nargs(1).valid(new FailedTest());
+        EXPECT_THROW(
+            {
+                try {
+                    args.parseArguments(argcOrder, const_cast<char**>(argvOrder));
+                }
+                catch (const blet::Args::ParseArgumentValidException& e) {
+                    EXPECT_STREQ(e.argument(), "--aaa");
+                    throw;
+                }
+            },
+            blet::Args::ParseArgumentValidException);
+    }
+    {
+        // the string rendered by a valid is not kept after the write back
+        struct CacheTest : public blet::Args::IValid {
+            explicit CacheTest(blet::Args& args) :
+                args_(args) {}
+            bool isValid(std::vector<std::string>& arguments) {
+                EXPECT_EQ(args_["--option"].getString(), "foo");
+                arguments.front() = "bar";
+                return true;
+            }
+            blet::Args& args_;
+        };
+        blet::Args args;
+        args.addArgument("--option").nargs(1).valid(new CacheTest(args));
+        args.parseArguments(argc, const_cast<char**>(argv));
+        EXPECT_EQ(args["--option"].getString(), "bar");
+    }
 }
 
 MOCKC_ATTRIBUTE_METHOD2(int, stat, (const char* __restrict __file, struct stat* __restrict __buf), throw());
@@ -856,3 +997,819 @@ GTEST_TEST(parseArguments, standartValid) {
         EXPECT_EQ(args["--option"].getString(), std::string("."));
     }
 }
+
+static std::string s_createResponseFile(const char* content, std::size_t size) {
+    char path[] = "/tmp/blet_args_response_XXXXXX";
+    int fd = ::mkstemp(path);
+    EXPECT_NE(fd, -1);
+    EXPECT_EQ(::write(fd, content, size), static_cast<ssize_t>(size));
+    ::close(fd);
+    return path;
+}
+
+GTEST_TEST(parseArguments, responseFile) {
+    {
+        const char content[] = "--option\nfoo\r\n\nbar\n-b";
+        std::string path = s_createResponseFile(content, sizeof(content) - 1);
+        std::string responseArgument = "@" + path;
+        const char* argv[] = {"binaryName", responseArgument.c_str(), "baz"};
+        const int argc = sizeof(argv) / sizeof(*argv);
+        blet::Args args;
+        args.setResponseFile();
+        args.addArgument("--option").action(blet::Args::INFINITE);
+        args.addArgument("-b").action(blet::Args::STORE_TRUE);
+        args.addArgument("ARG");
+        args.parseArguments(argc, const_cast<char**>(argv));
+        ::unlink(path.c_str());
+        std::vector<std::string> options = args["--option"];
+        ASSERT_EQ(options.size(), 2);
+        EXPECT_EQ(options[0], "foo");
+        EXPECT_EQ(options[1], "bar");
+        EXPECT_EQ(args["-b"].isExists(), true);
+        EXPECT_EQ(args["ARG"].getString(), "baz");
+    }
+    {
+        const char content[] = "--option\0foo bar\0\0baz";
+        std::string path = s_createResponseFile(content, sizeof(content) - 1);
+        std::string responseArgument = "@" + path;
+        const char* argv[] = {"binaryName", responseArgument.c_str(), "--", "@ARG"};
+        const int argc = sizeof(argv) / sizeof(*argv);
+        blet::Args args;
+        args.setResponseFile(blet::Args::ResponseFile::NUL);
+        args.addArgument("--option").action(blet::Args::INFINITE);
+        args.addArgument("ARG");
+        args.parseArguments(argc, const_cast<char**>(argv));
+        ::unlink(path.c_str());
+        std::vector<std::string> options = args["--option"];
+        ASSERT_EQ(options.size(), 2);
+        EXPECT_EQ(options[0], "foo bar");
+        EXPECT_EQ(options[1], "baz");
+        EXPECT_EQ(args["ARG"].getString(), "@ARG");
+    }
+    {
+        const char content[] = "# comment\n--option 'foo bar' \"a \\\"b\\\" c\"\n  d\\ e ''";
+        std::string path = s_createResponseFile(content, sizeof(content) - 1);
+        std::string responseArgument = "@" + path;
+        const char* argv[] = {"binaryName", responseArgument.c_str()};
+        const int argc = sizeof(argv) / sizeof(*argv);
+        blet::Args args;
+        args.setResponseFile(blet::Args::ResponseFile::SHELL);
+        args.addArgument("--option").action(blet::Args::INFINITE);
+        args.parseArguments(argc, const_cast<char**>(argv));
+        ::unlink(path.c_str());
+        std::vector<std::string> options = args["--option"];
+        ASSERT_EQ(options.size(), 4);
+        EXPECT_EQ(options[0], "foo bar");
+        EXPECT_EQ(options[1], "a \"b\" c");
+        EXPECT_EQ(options[2], "d e");
+        EXPECT_EQ(options[3], "");
+    }
+    {
+        const char content[] = "--option 'foo";
+        std::string path = s_createResponseFile(content, sizeof(content) - 1);
+        std::string responseArgument = "@" + path;
+        const char* argv[] = {"binaryName", responseArgument.c_str()};
+        const int argc = sizeof(argv) / sizeof(*argv);
+        blet::Args args;
+        args.setResponseFile(blet::Args::ResponseFile::SHELL);
+        args.addArgument("--option");
+        EXPECT_THROW(
+            {
+                try {
+                    args.parseArguments(argc, const_cast<char**>(argv));
+                }
+                catch (const blet::Args::ParseArgumentException& e) {
+                    EXPECT_STREQ(e.what(), "unterminated quote in response file");
+                    EXPECT_STREQ(e.argument(), responseArgument.c_str());
+                    throw;
+                }
+            },
+            blet::Args::ParseArgumentException);
+        ::unlink(path.c_str());
+    }
+    {
+        const char* argv[] = {"binaryName", "@/not/exists/file"};
+        const int argc = sizeof(argv) / sizeof(*argv);
+        blet::Args args;
+        args.setResponseFile();
+        EXPECT_THROW(
+            {
+                try {
+                    args.parseArguments(argc, const_cast<char**>(argv));
+                }
+                catch (const blet::Args::ParseArgumentException& e) {
+                    EXPECT_STREQ(e.what(), "cannot open response file");
+                    EXPECT_STREQ(e.argument(), "@/not/exists/file");
+                    throw;
+                }
+            },
+            blet::Args::ParseArgumentException);
+    }
+    {
+        const char* argv[] = {"binaryName", "@file"};
+        const int argc = sizeof(argv) / sizeof(*argv);
+        blet::Args args;
+        args.addArgument("ARG");
+        args.parseArguments(argc, const_cast<char**>(argv));
+        EXPECT_EQ(args["ARG"].getString(), "@file");
+    }
+}
+
+GTEST_TEST(parseArguments, responseFileMemory) {
+    std::size_t usages[2];
+    const int counts[2] = {1000, 100000};
+    for (int i = 0; i < 2; ++i) {
+        std::string content;
+        for (int j = 0; j < counts[i]; ++j) {
+            char line[64];
+            ::snprintf(line, sizeof(line), "/path/to/file_%08d.txt\n", j);
+            content += line;
+        }
+        content += "--\nlast";
+        std::string path = s_createResponseFile(content.c_str(), content.size());
+        std::string responseArgument = "@" + path;
+        const char* argv[] = {"binaryName", "--files", responseArgument.c_str(), "-b"};
+        blet::Args::ResponseFile responseFile(blet::Args::ResponseFile::NEWLINE);
+        ASSERT_TRUE(responseFile.expand(sizeof(argv) / sizeof(*argv), const_cast<char**>(argv)));
+        ::unlink(path.c_str());
+        ASSERT_EQ(responseFile.argc(), counts[i] + 5);
+        EXPECT_EQ(responseFile.endOptionIndex(0), counts[i] + 2);
+        EXPECT_STREQ(responseFile.token(1), "--files");
+        for (int j = 0; j < counts[i]; ++j) {
+            char line[64];
+            ::snprintf(line, sizeof(line), "/path/to/file_%08d.txt", j);
+            ASSERT_STREQ(responseFile.token(j + 2), line);
+        }
+        EXPECT_STREQ(responseFile.token(counts[i] + 3), "last");
+        EXPECT_STREQ(responseFile.token(counts[i] + 4), "-b");
+        // the tokens before the last tokens are read again
+        EXPECT_STREQ(responseFile.token(2), "/path/to/file_00000000.txt");
+        usages[i] = responseFile.memoryUsage();
+    }
+    // the memory does not depend of the size of file
+    EXPECT_EQ(usages[0], usages[1]);
+}
+
+static int s_createInput(const char* content, std::size_t size) {
+    // regular file: a pipe can't buffer the big inputs before the parse
+    char path[] = "/tmp/blet_args_input_XXXXXX";
+    int fd = ::mkstemp(path);
+    EXPECT_NE(fd, -1);
+    ::unlink(path);
+    EXPECT_EQ(::write(fd, content, size), static_cast<ssize_t>(size));
+    ::lseek(fd, 0, SEEK_SET);
+    return fd;
+}
+
+GTEST_TEST(parseArguments, input) {
+    {
+        const char content[] = "foo\0bar baz\0\0qux";
+        int fd = s_createInput(content, sizeof(content) - 1);
+        const char* argv[] = {"binaryName", "first", "-", "last"};
+        const int argc = sizeof(argv) / sizeof(*argv);
+        blet::Args args;
+        args.addArgument("ARGS").action(blet::Args::INFINITE).input('\0', fd);
+        args.parseArguments(argc, const_cast<char**>(argv));
+        ::close(fd);
+        std::vector<std::string> arguments = args["ARGS"];
+        ASSERT_EQ(arguments.size(), 5);
+        EXPECT_EQ(arguments[0], "first");
+        EXPECT_EQ(arguments[1], "foo");
+        EXPECT_EQ(arguments[2], "bar baz");
+        EXPECT_EQ(arguments[3], "qux");
+        EXPECT_EQ(arguments[4], "last");
+    }
+    {
+        const char content[] = "foo\r\nbar\n\n";
+        int fd = s_createInput(content, sizeof(content) - 1);
+        const char* argv[] = {"binaryName", "--option=-"};
+        const int argc = sizeof(argv) / sizeof(*argv);
+        blet::Args args;
+        args.addArgument("--option").action(blet::Args::INFINITE).input('\n', fd);
+        args.parseArguments(argc, const_cast<char**>(argv));
+        ::close(fd);
+        std::vector<std::string> arguments = args["--option"];
+        ASSERT_EQ(arguments.size(), 2);
+        EXPECT_EQ(arguments[0], "foo");
+        EXPECT_EQ(arguments[1], "bar");
+    }
+    {
+        // value bigger than a chunk
+        std::string content;
+        for (std::size_t i = 0; i < 100000; ++i) {
+            content += static_cast<char>('a' + i % 26);
+        }
+        content += '\n';
+        content += "end";
+        int fd = s_createInput(content.c_str(), content.size());
+        const char* argv[] = {"binaryName", "--option", "-", "-b"};
+        const int argc = sizeof(argv) / sizeof(*argv);
+        blet::Args args;
+        args.addArgument("--option").action(blet::Args::INFINITE).input('\n', fd);
+        args.addArgument("-b").action(blet::Args::STORE_TRUE);
+        args.parseArguments(argc, const_cast<char**>(argv));
+        ::close(fd);
+        std::vector<std::string> arguments = args["--option"];
+        ASSERT_EQ(arguments.size(), 2);
+        EXPECT_EQ(arguments[0], content.substr(0, 100000));
+        EXPECT_EQ(arguments[1], "end");
+        EXPECT_EQ(args["-b"].isExists(), true);
+    }
+    {
+        const char* argv[] = {"binaryName", "-"};
+        const int argc = sizeof(argv) / sizeof(*argv);
+        blet::Args args;
+        args.addArgument("ARGS").action(blet::Args::INFINITE).input('\0', -2);
+        EXPECT_THROW(
+            {
+                try {
+                    args.parseArguments(argc, const_cast<char**>(argv));
+                }
+                catch (const blet::Args::ParseArgumentException& e) {
+                    EXPECT_STREQ(e.what(), "cannot read input");
+                    EXPECT_STREQ(e.argument(), "ARGS");
+                    throw;
+                }
+            },
+            blet::Args::ParseArgumentException);
+    }
+}
+
+static void s_streamToSum(long& sum, const char* argument) {
+    sum += ::strtol(argument, NULL, 10);
+}
+
+static void s_streamToVector(std::vector<std::string>& dest, const char* argument) {
+    dest.push_back(argument);
+}
+
+GTEST_TEST(parseArguments, streamDest) {
+    {
+        const char content[] = "3\n4\n5";
+        int fd = s_createInput(content, sizeof(content) - 1);
+        const char* argv[] = {"binaryName", "1", "2", "-", "--multi", "foo", "--multi=bar", "--infinite", "a", "b"};
+        const int argc = sizeof(argv) / sizeof(*argv);
+        long sum = 0;
+        std::vector<std::string> multi;
+        std::vector<std::string> infinite;
+        std::vector<std::string> defaults;
+        blet::Args args;
+        args.addArgument("ARGS").action(blet::Args::INFINITE).input('\n', fd).dest(sum, &s_streamToSum);
+        args.addArgument("--multi").action(blet::Args::APPEND).dest(multi, &s_streamToVector);
+        args.addArgument("--infinite").action(blet::Args::INFINITE).dest(infinite, &s_streamToVector);
+        args.addArgument("--default")
+            .action(blet::Args::INFINITE)
+            .defaults(args.vector("x", "y"))
+            .dest(defaults, &s_streamToVector);
+        args.parseArguments(argc, const_cast<char**>(argv));
+        ::close(fd);
+        EXPECT_EQ(sum, 15);
+        // values are not kept
+        EXPECT_EQ(args["ARGS"].isExists(), true);
+        EXPECT_EQ(args["ARGS"].size(), 0);
+        ASSERT_EQ(multi.size(), 2);
+        EXPECT_EQ(multi[0], "foo");
+        EXPECT_EQ(multi[1], "bar");
+        ASSERT_EQ(infinite.size(), 2);
+        EXPECT_EQ(infinite[0], "a");
+        EXPECT_EQ(infinite[1], "b");
+        ASSERT_EQ(defaults.size(), 2);
+        EXPECT_EQ(defaults[0], "x");
+        EXPECT_EQ(defaults[1], "y");
+    }
+    {
+        const char* argv[] = {"binaryName", "--option", "foo"};
+        const int argc = sizeof(argv) / sizeof(*argv);
+        std::vector<std::string> option;
+        blet::Args args;
+        args.addArgument("--option").dest(option, &s_streamToVector);
+        args.parseArguments(argc, const_cast<char**>(argv));
+        ASSERT_EQ(option.size(), 1);
+        EXPECT_EQ(option[0], "foo");
+    }
+    {
+        const char* argv[] = {"binaryName", "1", "42", "3"};
+        const int argc = sizeof(argv) / sizeof(*argv);
+        long sum = 0;
+        blet::Args args;
+        args.addArgument("ARGS")
+            .action(blet::Args::INFINITE)
+            .valid(new blet::Args::ValidMinMax(0, 10))
+            .dest(sum, &s_streamToSum);
+        EXPECT_THROW(
+            {
+                try {
+                    args.parseArguments(argc, const_cast<char**>(argv));
+                }
+                catch (const blet::Args::ParseArgumentValidException& e) {
+                    EXPECT_STREQ(e.argument(), "ARGS");
+                    throw;
+                }
+            },
+            blet::Args::ParseArgumentValidException);
+        EXPECT_EQ(sum, 1);
+    }
+}
+
+struct ParseArgumentsFields {
+    bool verbose;
+    int number;
+    std::vector<std::string> files;
+    std::vector<std::vector<double> > points;
+};
+
+GTEST_TEST(parseArguments, fields) {
+    static const blet::Args::Field fields[] = {
+        ARGS_FIELD(ParseArgumentsFields, verbose, "--verbose"),
+        ARGS_FIELD(ParseArgumentsFields, number, "-n"),
+        ARGS_FIELD(ParseArgumentsFields, files, "FILES"),
+        ARGS_FIELD(ParseArgumentsFields, points, "--point"),
+    };
+    {
+        const char* argv[] = {"binaryName", "--verbose", "-n", "42", "--point", "1", "2", "--point", "3", "4", "a", "b"};
+        const int argc = sizeof(argv) / sizeof(*argv);
+        ParseArgumentsFields options;
+        blet::Args args;
+        args.addArgument("--verbose").action(blet::Args::STORE_TRUE);
+        args.addArgument("-n").defaults("0");
+        args.addArgument("--point").action(blet::Args::APPEND).nargs(2);
+        args.addArgument("FILES").action(blet::Args::INFINITE);
+        args.parseArguments(argc, const_cast<char**>(argv), options, fields);
+        EXPECT_EQ(options.verbose, true);
+        EXPECT_EQ(options.number, 42);
+        ASSERT_EQ(options.files.size(), 2);
+        EXPECT_EQ(options.files[0], "a");
+        EXPECT_EQ(options.files[1], "b");
+        ASSERT_EQ(options.points.size(), 2);
+        ASSERT_EQ(options.points[1].size(), 2);
+        EXPECT_EQ(options.points[1][0], 3);
+        EXPECT_EQ(options.points[1][1], 4);
+    }
+    {
+        // the fields are checked before the parse: nothing is written with a bad table
+        const char* argv[] = {"binaryName", "-n", "42", "a"};
+        const int argc = sizeof(argv) / sizeof(*argv);
+        ParseArgumentsFields options;
+        options.verbose = true;
+        options.number = 7;
+        int number = 7;
+        blet::Args args;
+        args.addArgument("--verbose").action(blet::Args::STORE_TRUE);
+        args.addArgument("-n").defaults("0").dest(number);
+        args.addArgument("FILES").action(blet::Args::INFINITE);
+        EXPECT_THROW(
+            {
+                try {
+                    args.parseArguments(argc, const_cast<char**>(argv), options, fields);
+                }
+                catch (const blet::Args::AccessDeniedException& e) {
+                    EXPECT_STREQ(e.argument(), "--point");
+                    throw;
+                }
+            },
+            blet::Args::AccessDeniedException);
+        EXPECT_EQ(options.verbose, true);
+        EXPECT_EQ(options.number, 7);
+        EXPECT_EQ(number, 7);
+        EXPECT_FALSE(args["-n"].isExists());
+    }
+}
+
+GTEST_TEST(parseArguments, destRebind) {
+    const char* argv[] = {"binaryName", "--option", "42", "a", "b"};
+    const int argc = sizeof(argv) / sizeof(*argv);
+    int first = 0;
+    int second = 0;
+    std::vector<std::string> positional;
+    blet::Args args;
+    blet::args::Argument& option = args.addArgument("--option");
+    EXPECT_EQ(&option.dest(first), &option);
+    EXPECT_EQ(&option.dest(second), &option);
+    args.addArgument("ARGS").action(blet::Args::INFINITE).dest(positional, &s_streamToVector).dest(positional);
+    args.parseArguments(argc, const_cast<char**>(argv));
+    EXPECT_EQ(first, 0);
+    EXPECT_EQ(second, 42);
+    ASSERT_EQ(positional.size(), 2);
+    EXPECT_EQ(positional[0], "a");
+    EXPECT_EQ(positional[1], "b");
+    EXPECT_EQ(args["ARGS"].size(), 2);
+}
+
+GTEST_TEST(parseArguments, reparse) {
+    const char* argv1[] = {"binaryName", "--point", "1", "2", "--point", "3", "4", "--file", "a", "--file", "b", "-n",
+                           "5",          "6"};
+    const int argc1 = sizeof(argv1) / sizeof(*argv1);
+    const char* argv2[] = {"binaryName", "--point", "7", "8"};
+    const int argc2 = sizeof(argv2) / sizeof(*argv2);
+    blet::Args args;
+    args.addArgument("--point").action(blet::Args::APPEND).nargs(2);
+    args.addArgument("--file").action(blet::Args::APPEND).defaults("x");
+    args.addArgument("-n").nargs(2).defaults({"0", "0"});
+    args.parseArguments(argc1, const_cast<char**>(argv1));
+    ASSERT_EQ(args["--point"].size(), 2);
+    ASSERT_EQ(args["--file"].size(), 2);
+    EXPECT_EQ(args["-n"].getString(), "5, 6");
+    // the values of previous parse are replaced by the defaults
+    args.parseArguments(argc2, const_cast<char**>(argv2));
+    ASSERT_EQ(args["--point"].size(), 1);
+    EXPECT_EQ(args["--point"][0][0].getString(), "7");
+    EXPECT_EQ(args["--point"][0][1].getNumber(), 8);
+    ASSERT_EQ(args["--file"].size(), 1);
+    EXPECT_EQ(args["--file"][0].getString(), "x");
+    EXPECT_EQ(args["--file"].isExists(), false);
+    ASSERT_EQ(args["-n"].size(), 2);
+    EXPECT_EQ(args["-n"].getString(), "0, 0");
+    EXPECT_EQ(args["-n"][1].isNumber(), true);
+}
+
+GTEST_TEST(parseArguments, handle) {
+    const char* argv[] = {"binaryName", "-v", "--number", "42", "a", "b"};
+    const int argc = sizeof(argv) / sizeof(*argv);
+    blet::Args args;
+    blet::Args::Handle verbose = args.addArgument("-v").action(blet::Args::STORE_TRUE);
+    blet::Args::Handle number = args.addArgument("--number");
+    blet::Args::Handle files = args.addArgument("FILES").action(blet::Args::INFINITE);
+    blet::Args::Handle removed = args.addArgument("--removed");
+    args.removeArguments("--removed");
+    args.parseArguments(argc, const_cast<char**>(argv));
+    EXPECT_EQ(args[verbose].isExists(), true);
+    EXPECT_EQ(&args[number], &args["--number"]);
+    int numberValue = 0;
+    number.get(numberValue);
+    EXPECT_EQ(numberValue, 42);
+    std::vector<std::string> filesValue;
+    files.get(filesValue);
+    ASSERT_EQ(filesValue.size(), 2);
+    EXPECT_EQ(filesValue[1], "b");
+    EXPECT_THROW(args[removed], blet::Args::AccessDeniedException);
+    EXPECT_THROW(args[blet::Args::Handle()], blet::Args::AccessDeniedException);
+    // the index of removed argument is reused but not its handles
+    blet::Args::Handle reused = args.addArgument("--reused");
+    EXPECT_EQ(reused.index(), removed.index());
+    EXPECT_EQ(&args[reused], &args["--reused"]);
+    EXPECT_THROW(args[removed], blet::Args::AccessDeniedException);
+    blet::Args otherArgs;
+    EXPECT_THROW(otherArgs[verbose], blet::Args::AccessDeniedException);
+    // the indexes restart after clear but not the handles
+    blet::Args::Handle help = args.getArgument("-h");
+    blet::Args::Handle old = args.addArgument("--old");
+    args.clear();
+    blet::Args::Handle renewed = args.addArgument("--new");
+    EXPECT_EQ(renewed.index(), help.index());
+    EXPECT_EQ(&args[renewed], &args["--new"]);
+    EXPECT_THROW(args[help], blet::Args::AccessDeniedException);
+    EXPECT_THROW(args[old], blet::Args::AccessDeniedException);
+}
+
+GTEST_TEST(parseArguments, manyArguments) {
+    blet::Args args(false);
+    for (int i = 0; i < 200; ++i) {
+        char flag[32];
+        ::snprintf(flag, sizeof(flag), "--option-%d", i);
+        args.addArgument(std::string(flag));
+    }
+    std::string dest70("not modified");
+    std::string dest150("not modified");
+    args.updateArgument("--option-70").defaults({"default"}).dest(dest70);
+    args.updateArgument("--option-150").dest(dest150);
+    args.updateArgument("--option-130").required();
+    {
+        const char* argv[] = {"binaryName", "--option-150", "foo"};
+        const int argc = sizeof(argv) / sizeof(*argv);
+        try {
+            args.parseArguments(argc, const_cast<char**>(argv));
+            ADD_FAILURE() << "Expected exception";
+        }
+        catch (const blet::Args::ParseArgumentRequiredException& e) {
+            EXPECT_STREQ(e.what(), "option is required");
+            EXPECT_STREQ(e.argument(), "--option-130");
+        }
+    }
+    {
+        const char* argv[] = {"binaryName", "--option-130", "bar", "--option-150", "foo"};
+        const int argc = sizeof(argv) / sizeof(*argv);
+        args.parseArguments(argc, const_cast<char**>(argv));
+        EXPECT_EQ(dest70, "default");
+        EXPECT_EQ(dest150, "foo");
+        EXPECT_EQ(args["--option-130"].getString(), "bar");
+    }
+    args.removeArguments("--option-130");
+    {
+        const char* argv[] = {"binaryName"};
+        const int argc = sizeof(argv) / sizeof(*argv);
+        args.parseArguments(argc, const_cast<char**>(argv));
+        EXPECT_EQ(dest150, "");
+    }
+}
+
+GTEST_TEST(parseArguments, constraints) {
+    blet::Args args(false);
+    args.addArgument("-a").action(args.STORE_TRUE);
+    args.addArgument("-b").action(args.STORE_TRUE);
+    args.addArgument("--output");
+    args.addArgument("--format");
+    args.addArgument("--quiet").action(args.STORE_TRUE);
+    args.addArgument("--verbose").action(args.STORE_TRUE);
+    args.addExclusiveGroup({"-a", "-b"}, true);
+    args.addRequirement("--format", {"--output"});
+    args.addConflict("--quiet", {"--verbose"});
+    EXPECT_THROW(args.addExclusiveGroup({"-a", "--unknown"}), blet::Args::ArgumentException);
+    EXPECT_THROW(args.addRequirement("--unknown", {"-a"}), blet::Args::ArgumentException);
+    EXPECT_THROW(args.addConflict("-a", blet::args::Vector()), blet::Args::ArgumentException);
+    {
+        const char* argv[] = {"binaryName", "-a", "--format", "json", "--output", "file", "--verbose"};
+        const int argc = sizeof(argv) / sizeof(*argv);
+        args.parseArguments(argc, const_cast<char**>(argv));
+        EXPECT_TRUE(args["-a"].isExists());
+        EXPECT_EQ(args["--format"].getString(), "json");
+    }
+    {
+        const char* argv[] = {"binaryName", "-b", "-a"};
+        const int argc = sizeof(argv) / sizeof(*argv);
+        try {
+            args.parseArguments(argc, const_cast<char**>(argv));
+            ADD_FAILURE() << "Expected exception";
+        }
+        catch (const blet::Args::ParseArgumentException& e) {
+            EXPECT_STREQ(e.what(), "not allowed with argument -a");
+            EXPECT_STREQ(e.argument(), "-b");
+        }
+    }
+    {
+        const char* argv[] = {"binaryName", "--quiet"};
+        const int argc = sizeof(argv) / sizeof(*argv);
+        try {
+            args.parseArguments(argc, const_cast<char**>(argv));
+            ADD_FAILURE() << "Expected exception";
+        }
+        catch (const blet::Args::ParseArgumentRequiredException& e) {
+            EXPECT_STREQ(e.what(), "one of the arguments -a -b is required");
+            EXPECT_STREQ(e.argument(), "-a");
+        }
+    }
+    {
+        const char* argv[] = {"binaryName", "-b", "--format", "json"};
+        const int argc = sizeof(argv) / sizeof(*argv);
+        try {
+            args.parseArguments(argc, const_cast<char**>(argv));
+            ADD_FAILURE() << "Expected exception";
+        }
+        catch (const blet::Args::ParseArgumentRequiredException& e) {
+            EXPECT_STREQ(e.what(), "argument is required by --format");
+            EXPECT_STREQ(e.argument(), "--output");
+        }
+    }
+    {
+        const char* argv[] = {"binaryName", "-b", "--verbose", "--quiet"};
+        const int argc = sizeof(argv) / sizeof(*argv);
+        try {
+            args.parseArguments(argc, const_cast<char**>(argv));
+            ADD_FAILURE() << "Expected exception";
+        }
+        catch (const blet::Args::ParseArgumentException& e) {
+            EXPECT_STREQ(e.what(), "not allowed with argument --verbose");
+            EXPECT_STREQ(e.argument(), "--quiet");
+        }
+    }
+    // the removed arguments are removed from the constraints
+    args.removeArguments({"-a", "-b", "--verbose"});
+    {
+        const char* argv[] = {"binaryName", "--quiet"};
+        const int argc = sizeof(argv) / sizeof(*argv);
+        args.parseArguments(argc, const_cast<char**>(argv));
+        EXPECT_TRUE(args["--quiet"].isExists());
+    }
+}
+
+static int s_buildCount = 0;
+
+static void s_buildCommit(blet::Args& args) {
+    ++s_buildCount;
+    args.addArgument("-m").help("message");
+    args.addArgument("--amend").action(args.STORE_TRUE);
+}
+
+static void s_buildPush(blet::Args& args) {
+    ++s_buildCount;
+    args.addArgument("remote");
+}
+
+GTEST_TEST(parseArguments, subcommands) {
+    s_buildCount = 0;
+    blet::Args args;
+    args.setHelpException();
+    args.addArgument("-v").action(args.STORE_TRUE);
+    args.addSubcommand("commit", &s_buildCommit, "record changes");
+    args.addSubcommand("push", &s_buildPush, "update remote");
+    for (int i = 0; i < 100; ++i) {
+        char name[32];
+        ::snprintf(name, sizeof(name), "command%d", i);
+        args.addSubcommand(name, &s_buildPush);
+    }
+    EXPECT_THROW(args.addSubcommand("push", &s_buildPush), blet::Args::ArgumentException);
+    EXPECT_THROW(args.addSubcommand("-push", &s_buildPush), blet::Args::ArgumentException);
+    EXPECT_THROW(args.getSubcommand(), blet::Args::AccessDeniedException);
+    EXPECT_THROW(args.getSubcommand("unknown"), blet::Args::AccessDeniedException);
+    EXPECT_EQ(s_buildCount, 0);
+    {
+        const char* argv[] = {"binaryName", "-v", "commit", "-m", "foo", "--amend"};
+        const int argc = sizeof(argv) / sizeof(*argv);
+        args.parseArguments(argc, const_cast<char**>(argv));
+        EXPECT_EQ(s_buildCount, 1);
+        EXPECT_TRUE(args["-v"].isExists());
+        EXPECT_EQ(args.getSubcommandName(), "commit");
+        EXPECT_EQ(args.getSubcommand()["-m"].getString(), "foo");
+        EXPECT_TRUE(args.getSubcommand()["--amend"].isExists());
+    }
+    {
+        const char* argv[] = {"binaryName", "command42", "origin"};
+        const int argc = sizeof(argv) / sizeof(*argv);
+        args.parseArguments(argc, const_cast<char**>(argv));
+        EXPECT_EQ(s_buildCount, 2);
+        EXPECT_FALSE(args["-v"].isExists());
+        EXPECT_EQ(args.getSubcommandName(), "command42");
+        EXPECT_EQ(args.getSubcommand()["remote"].getString(), "origin");
+        EXPECT_EQ(&args.getSubcommand(), &args.getSubcommand("command42"));
+    }
+    {
+        const char* argv[] = {"binaryName", "commit", "--help"};
+        const int argc = sizeof(argv) / sizeof(*argv);
+        try {
+            args.parseArguments(argc, const_cast<char**>(argv));
+            ADD_FAILURE() << "Expected exception";
+        }
+        catch (const blet::Args::HelpException& e) {
+            EXPECT_EQ(s_buildCount, 2);
+            EXPECT_EQ(std::string(e.what()).substr(0, 29), "usage: binaryName commit [-h]");
+        }
+    }
+    {
+        const char content[] = "commit\n-m\nfoo bar\n--amend";
+        std::string path = s_createResponseFile(content, sizeof(content) - 1);
+        std::string responseArgument = "@" + path;
+        const char* argv[] = {"binaryName", "-v", responseArgument.c_str()};
+        const int argc = sizeof(argv) / sizeof(*argv);
+        args.setResponseFile();
+        args.parseArguments(argc, const_cast<char**>(argv));
+        args.setResponseFile(blet::Args::ResponseFile::NONE);
+        ::unlink(path.c_str());
+        EXPECT_TRUE(args["-v"].isExists());
+        EXPECT_EQ(args.getSubcommandName(), "commit");
+        EXPECT_EQ(args.getSubcommand()["-m"].getString(), "foo bar");
+        EXPECT_TRUE(args.getSubcommand()["--amend"].isExists());
+    }
+    {
+        const char* argv[] = {"binaryName", "unknown"};
+        const int argc = sizeof(argv) / sizeof(*argv);
+        args.parseArguments(argc, const_cast<char**>(argv));
+        EXPECT_EQ(args.getSubcommandName(), "");
+        ASSERT_EQ(args.getAdditionalArguments().size(), 1);
+        EXPECT_EQ(args.getAdditionalArguments()[0], "unknown");
+    }
+    args.clear();
+    args.addSubcommand("commit", &s_buildCommit, "record changes");
+    args.addSubcommand("push", &s_buildPush, "update remote");
+    args.setBinaryName("binaryName");
+    EXPECT_EQ(args.getUsage(),
+              "usage: binaryName command ...\n"
+              "\n"
+              "commands:\n"
+              "  commit                record changes\n"
+              "  push                  update remote");
+}
+
+GTEST_TEST(parseArguments, abbreviation) {
+    blet::Args args(false);
+    args.addArgument("--verbose").flag("--verbosity").action(args.STORE_TRUE);
+    args.addArgument("--version").action(args.STORE_TRUE);
+    args.addArgument("--output");
+    {
+        const char* argv[] = {"binaryName", "--verb", "--out", "file"};
+        const int argc = sizeof(argv) / sizeof(*argv);
+        EXPECT_THROW(args.parseArguments(argc, const_cast<char**>(argv)), blet::Args::ParseArgumentException);
+        args.setAbbreviation();
+        args.parseArguments(argc, const_cast<char**>(argv));
+        EXPECT_TRUE(args["--verbose"].isExists());
+        EXPECT_EQ(args["--output"].getString(), "file");
+    }
+    {
+        const char* argv[] = {"binaryName", "--ver"};
+        const int argc = sizeof(argv) / sizeof(*argv);
+        try {
+            args.parseArguments(argc, const_cast<char**>(argv));
+            ADD_FAILURE() << "Expected exception";
+        }
+        catch (const blet::Args::ParseArgumentException& e) {
+            EXPECT_STREQ(e.what(), "ambiguous option could match --verbose, --verbosity, --version");
+            EXPECT_STREQ(e.argument(), "ver");
+        }
+    }
+    // the index follows the changes of arguments
+    args.removeArguments("--version");
+    args.addArgument("--zzz").action(args.STORE_TRUE);
+    {
+        const char* argv[] = {"binaryName", "--ver", "--z"};
+        const int argc = sizeof(argv) / sizeof(*argv);
+        args.parseArguments(argc, const_cast<char**>(argv));
+        EXPECT_TRUE(args["--verbose"].isExists());
+        EXPECT_TRUE(args["--zzz"].isExists());
+    }
+    {
+        const char* argv[] = {"binaryName", "--x"};
+        const int argc = sizeof(argv) / sizeof(*argv);
+        EXPECT_THROW(args.parseArguments(argc, const_cast<char**>(argv)), blet::Args::ParseArgumentException);
+    }
+    // the values of infinite argument end at an abbreviated option
+    args.addArgument("--ids").nargs('+');
+    {
+        const char* argv[] = {"binaryName", "--ids", "1", "2", "--verb"};
+        const int argc = sizeof(argv) / sizeof(*argv);
+        args.parseArguments(argc, const_cast<char**>(argv));
+        EXPECT_EQ(args["--ids"].getString(), "1, 2");
+        EXPECT_TRUE(args["--verbose"].isExists());
+        EXPECT_EQ(args.complete(argc, const_cast<char**>(argv), 4).size(), 2);
+    }
+    args.addArgument("--verify").action(args.STORE_TRUE);
+    {
+        const char* argv[] = {"binaryName", "--ids", "1", "--ver"};
+        const int argc = sizeof(argv) / sizeof(*argv);
+        EXPECT_THROW(args.parseArguments(argc, const_cast<char**>(argv)), blet::Args::ParseArgumentException);
+    }
+}
+
+GTEST_TEST(parseArguments, complete) {
+    blet::Args args;
+    args.addArgument("--verbose").flag("-v").action(args.STORE_TRUE);
+    args.addArgument("--version").action(args.VERSION);
+    args.addArgument("--format").flag("-f").valid(new blet::Args::ValidChoise(args.vector("json", "jar", "xml")));
+    args.addArgument("--files").nargs('+');
+    args.addArgument("--required").required(true).valid(new blet::Args::ValidNumber());
+    args.addSubcommand("commit", &s_buildCommit, "record changes");
+    args.addSubcommand("command", &s_buildPush);
+    {
+        const char* argv[] = {"binaryName", "--ver"};
+        const int argc = sizeof(argv) / sizeof(*argv);
+        std::vector<std::string> candidates = args.complete(argc, const_cast<char**>(argv), 1);
+        ASSERT_EQ(candidates.size(), 2);
+        EXPECT_EQ(candidates[0], "--verbose");
+        EXPECT_EQ(candidates[1], "--version");
+    }
+    {
+        const char* argv[] = {"binaryName", "-"};
+        const int argc = sizeof(argv) / sizeof(*argv);
+        std::vector<std::string> candidates = args.complete(argc, const_cast<char**>(argv), 1);
+        EXPECT_EQ(candidates.size(), 9);
+    }
+    {
+        const char* argv[] = {"binaryName", "-v", "--format"};
+        const int argc = sizeof(argv) / sizeof(*argv);
+        std::vector<std::string> candidates = args.complete(argc, const_cast<char**>(argv), argc);
+        ASSERT_EQ(candidates.size(), 3);
+        EXPECT_EQ(candidates[0], "jar");
+    }
+    {
+        const char* argv[] = {"binaryName", "-vf", "j"};
+        const int argc = sizeof(argv) / sizeof(*argv);
+        std::vector<std::string> candidates = args.complete(argc, const_cast<char**>(argv), 2);
+        ASSERT_EQ(candidates.size(), 2);
+        EXPECT_EQ(candidates[0], "jar");
+        EXPECT_EQ(candidates[1], "json");
+    }
+    {
+        const char* argv[] = {"binaryName", "--format=x"};
+        const int argc = sizeof(argv) / sizeof(*argv);
+        std::vector<std::string> candidates = args.complete(argc, const_cast<char**>(argv), 1);
+        ASSERT_EQ(candidates.size(), 1);
+        EXPECT_EQ(candidates[0], "--format=xml");
+    }
+    {
+        // the values of infinite option end at the next option
+        const char* argv[] = {"binaryName", "--files", "a", "b", "-f", ""};
+        const int argc = sizeof(argv) / sizeof(*argv);
+        EXPECT_EQ(args.complete(argc, const_cast<char**>(argv), 5).size(), 3);
+        EXPECT_EQ(args.complete(argc, const_cast<char**>(argv), 3).size(), 0);
+    }
+    {
+        const char* argv[] = {"binaryName", "-fjson", "co"};
+        const int argc = sizeof(argv) / sizeof(*argv);
+        std::vector<std::string> candidates = args.complete(argc, const_cast<char**>(argv), 2);
+        ASSERT_EQ(candidates.size(), 2);
+        EXPECT_EQ(candidates[0], "commit");
+        EXPECT_EQ(candidates[1], "command");
+    }
+    {
+        const char* argv[] = {"binaryName", "commit", "--am"};
+        const int argc = sizeof(argv) / sizeof(*argv);
+        std::vector<std::string> candidates = args.complete(argc, const_cast<char**>(argv), 2);
+        ASSERT_EQ(candidates.size(), 1);
+        EXPECT_EQ(candidates[0], "--amend");
+    }
+    {
+        const char* argv[] = {"binaryName", "--", "-"};
+        const int argc = sizeof(argv) / sizeof(*argv);
+        EXPECT_EQ(args.complete(argc, const_cast<char**>(argv), 2).size(), 0);
+    }
+    // nothing is parsed
+    EXPECT_FALSE(args["--verbose"].isExists());
+    EXPECT_EQ(args.getSubcommandName(), "");
+}
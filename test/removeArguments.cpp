@@ -32,3 +32,31 @@ GTEST_TEST(removeArguments, exception) {
     EXPECT_EQ(args.argumentExists("-h"), false);
     EXPECT_EQ(args.argumentExists("--help"), false);
 }
+
+GTEST_TEST(removeArguments, reuseIndex) {
+    const char* argv[] = {"binaryName", "--a"};
+    const int argc = sizeof(argv) / sizeof(*argv);
+    blet::Args args;
+    args.addArgument("--a").action(args.STORE_TRUE);
+    args.addArgument("--b").action(args.STORE_TRUE);
+    args.addArgument("--c").action(args.STORE_TRUE);
+    args.addRequirement("--b", args.vector("--c"));
+    args.addArgument("--cycle").required();
+    args.removeArguments("--cycle");
+    std::size_t usage = args.memoryUsage();
+    // the add and remove cycles don't grow the object
+    for (int i = 0; i < 1000; ++i) {
+        args.addArgument("--cycle").required();
+        args.removeArguments("--cycle");
+    }
+    EXPECT_EQ(args.memoryUsage(), usage);
+    // the requirement of a removed source doesn't apply to the argument which reuses its index
+    args.removeArguments("--b");
+    args.addArgument("--d").action(args.STORE_TRUE);
+    const char* argvD[] = {"binaryName", "--d"};
+    args.parseArguments(sizeof(argvD) / sizeof(*argvD), const_cast<char**>(argvD));
+    EXPECT_EQ(args["--d"].isExists(), true);
+    args.parseArguments(argc, const_cast<char**>(argv));
+    EXPECT_EQ(args["--a"].isExists(), true);
+    EXPECT_EQ(args["--d"].isExists(), false);
+}